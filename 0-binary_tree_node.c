@@ -8,15 +8,111 @@
  */
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value)
 {
-	binary_tree_t *n_node = malloc(sizeof(binary_tree_t));
+	binary_tree_t *n_node = tree_node_alloc();
 
 	if (n_node == NULL)
 		return (NULL);
 
 	n_node->n = value;
+	n_node->height = 1;
+#ifdef BT_ORDER_STATS
+	n_node->size = 1;
+#endif
 	n_node->parent = parent;
 	n_node->left = NULL;
 	n_node->right = NULL;
 
 	return (n_node);
 }
+
+/**
+ * node_height - reads the cached height of a node
+ * @node: pointer to the node
+ * Return: number of nodes on the longest downward path, 0 if NULL
+ */
+int node_height(const binary_tree_t *node)
+{
+	return (node != NULL ? node->height : 0);
+}
+
+/**
+ * node_size - reads the cached subtree size of a node
+ * @node: pointer to the node
+ *
+ * Description: without BT_ORDER_STATS there is no cached size, and the
+ * subtree is counted in O(n) time and O(1) space by walking it through the
+ * parent links, coming back up from a child once it is done.
+ * Return: number of nodes in the subtree rooted at node, 0 if NULL
+ */
+size_t node_size(const binary_tree_t *node)
+{
+#ifdef BT_ORDER_STATS
+	return (node != NULL ? node->size : 0);
+#else
+	const binary_tree_t *walk = node, *prev = NULL, *next;
+	size_t size = 0;
+
+	while (walk != NULL)
+	{
+		next = NULL;
+		if (walk == node ? prev == NULL : prev == walk->parent)
+		{
+			size++;
+			next = walk->left != NULL ? walk->left : walk->right;
+		}
+		else if (prev == walk->left)
+			next = walk->right;
+		prev = walk;
+		if (next == NULL)
+			next = walk == node ? NULL : walk->parent;
+		walk = next;
+	}
+	return (size);
+#endif
+}
+
+/**
+ * node_update - refreshes the cached fields of a node from its children
+ * @node: pointer to the node, its children must already be up to date
+ */
+void node_update(binary_tree_t *node)
+{
+	int l_height, r_height;
+
+	if (node == NULL)
+		return;
+	BT_COUNT(height_updates, 1);
+	l_height = node_height(node->left);
+	r_height = node_height(node->right);
+	node->height = 1 + (l_height > r_height ? l_height : r_height);
+#ifdef BT_ORDER_STATS
+	node->size = 1 + node_size(node->left) + node_size(node->right);
+#endif
+}
+
+/**
+ * node_update_path - refreshes the cached fields of a node and of all
+ * its ancestors, after a leaf was added or removed below it
+ * @node: pointer to the deepest node to refresh
+ *
+ * Description: sizes change all the way up, so with BT_ORDER_STATS every
+ * ancestor is refreshed. Without it, the walk stops at the first node
+ * whose height did not change, as the ones above it cannot change either.
+ */
+void node_update_path(binary_tree_t *node)
+{
+#ifdef BT_ORDER_STATS
+	for (; node != NULL; node = node->parent)
+		node_update(node);
+#else
+	int height;
+
+	for (; node != NULL; node = node->parent)
+	{
+		height = node->height;
+		node_update(node);
+		if (node->height == height)
+			return;
+	}
+#endif
+}
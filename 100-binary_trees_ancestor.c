@@ -1,10 +1,31 @@
 #include "binary_trees.h"
 
+/**
+ * node_depth - counts the parent links above a node
+ * @node: pointer to the node
+ * Return: depth of the node, 0 for a root
+ */
+static size_t node_depth(const binary_tree_t *node)
+{
+	size_t depth = 0;
+
+	while (node->parent)
+	{
+		node = node->parent;
+		depth++;
+	}
+	return (depth);
+}
+
 /**
  * binary_trees_ancestor - finds the lowest common ancestor of
  * two nodes
  * @first: pointer to the first node
  * @second: pointer to the second node
+ *
+ * Description: the deeper node climbs until both are at the same depth,
+ * then both climb in step until they meet, which is O(depth) instead of
+ * comparing every pair of ancestors.
  * Return: pointer to the lowest common ancestor node of
  * the two nodes or NULL if no common ancester found
  */
@@ -13,22 +34,21 @@ binary_tree_t *binary_trees_ancestor(
 		const binary_tree_t *second
 		)
 {
-	const binary_tree_t *tmpo1, *tmpo2;
+	size_t d1, d2;
 
 	if (!first || !second)
 		return (NULL);
 
-	tmpo1 = first;
-	while (tmpo1)
+	d1 = node_depth(first);
+	d2 = node_depth(second);
+	for (; d1 > d2; d1--)
+		first = first->parent;
+	for (; d2 > d1; d2--)
+		second = second->parent;
+	while (first != second)
 	{
-		tmpo2 = second;
-		while (tmpo2)
-		{
-			if (tmpo1 == tmpo2)
-				return ((binary_tree_t *)tmpo1);
-			tmpo2 = tmpo2->parent;
-		}
-		tmpo1 = tmpo1->parent;
+		first = first->parent;
+		second = second->parent;
 	}
-	return (NULL);
+	return ((binary_tree_t *)first);
 }
@@ -1,73 +1,76 @@
 #include "binary_trees.h"
 
 /**
- * enqueue - enqueues a new node with data
+ * queue_grow - doubles the capacity of a queue, unwrapping its content
  * @queue: pointer to the queue
- * @data: data of the new node
+ * Return: 1 on success, 0 on failure
  */
-void enqueue(queue_t **queue, const binary_tree_t *data)
+static int queue_grow(queue_t *queue)
 {
-	queue_node_t *n_node = malloc(sizeof(queue_node_t));
+	size_t cap = queue->cap ? queue->cap * 2 : 64, x;
+	const binary_tree_t **buf = malloc(sizeof(*buf) * cap);
 
-	if (n_node == NULL)
-		return;
-
-	n_node->data = data;
-	n_node->next = NULL;
+	if (buf == NULL)
+		return (0);
+	for (x = 0; x < queue->count; x++)
+		buf[x] = queue->buf[(queue->head + x) & (queue->cap - 1)];
+	free(queue->buf);
+	queue->buf = buf;
+	queue->cap = cap;
+	queue->head = 0;
+	return (1);
+}
 
+/**
+ * enqueue - adds a node at the rear of the queue
+ * @queue: pointer to the queue, created on first use
+ * @data: node to add
+ *
+ * The buffer only grows when full, so this is amortized O(1) with no
+ * allocation per element.
+ * Return: 1 on success, 0 on failure
+ */
+int enqueue(queue_t **queue, const binary_tree_t *data)
+{
 	if (*queue == NULL)
 	{
-		*queue = malloc(sizeof(queue_t));
+		*queue = calloc(1, sizeof(queue_t));
 		if (*queue == NULL)
-		{
-			free(n_node);
-			return;
-		}
-		(*queue)->front = (*queue)->rear = n_node;
-	}
-	else
-	{
-		(*queue)->rear->next = n_node;
-		(*queue)->rear = n_node;
+			return (0);
 	}
+	if ((*queue)->count == (*queue)->cap && !queue_grow(*queue))
+		return (0);
+	(*queue)->buf[((*queue)->head + (*queue)->count++) &
+		((*queue)->cap - 1)] = data;
+	return (1);
 }
 
 /**
- * dequeue - dequeues a node from the queue
+ * dequeue - removes the node at the front of the queue
  * @queue: pointer to the queue
  * Return: dequeued node, or NULL if the queue is empty
  */
 const binary_tree_t *dequeue(queue_t **queue)
 {
-	queue_node_t *front_node = (*queue)->front;
-	const binary_tree_t *data = front_node->data;
+	const binary_tree_t *data;
 
-	if ((*queue) == NULL || (*queue)->front == NULL)
-	{
+	if (*queue == NULL || (*queue)->count == 0)
 		return (NULL);
-	}
-
-	(*queue)->front = front_node->next;
-	free(front_node);
-
-	if ((*queue)->front == NULL)
-	{
-		free(*queue);
-		*queue = NULL;
-	}
+	data = (*queue)->buf[(*queue)->head];
+	(*queue)->head = ((*queue)->head + 1) & ((*queue)->cap - 1);
+	(*queue)->count--;
 	return (data);
 }
 
 /**
- * free_queue - frees the queue and its nodes
+ * free_queue - frees the queue and its buffer
  * @queue: pointer to the queue
  */
 void free_queue(queue_t **queue)
 {
 	if (queue == NULL || *queue == NULL)
 		return;
-	while ((*queue)->front != NULL)
-		dequeue(queue);
+	free((*queue)->buf);
 	free(*queue);
 	*queue = NULL;
 }
@@ -78,6 +81,10 @@ void free_queue(queue_t **queue)
  * @tree: pointer to the root node of the tree to traverse
  * @func: pointer to a function to call for each node. the value
  * in the node must be passed as a parameter to this function
+ *
+ * Description: if the queue cannot grow, the traversal stops there rather
+ * than go on with whole subtrees missing, so func may have been called on
+ * the first levels only.
  * Return: void
  */
 void binary_tree_levelorder(const binary_tree_t *tree, void (*func)(int))
@@ -88,16 +95,19 @@ void binary_tree_levelorder(const binary_tree_t *tree, void (*func)(int))
 	if (tree == NULL || func == NULL)
 		return;
 	/* create a queue for the level-order traversal */
-	enqueue(&queue, tree);
+	if (!enqueue(&queue, tree))
+	{
+		free_queue(&queue);
+		return;
+	}
 	/* traverse the binary tree level by level */
-	while (queue != NULL && (current = dequeue(&queue)) != NULL)
+	while ((current = dequeue(&queue)) != NULL)
 	{
 		func(current->n);
 
-		if (current->left != NULL)
-			enqueue(&queue, current->left);
-		if (current->right != NULL)
-			enqueue(&queue, current->right);
+		if ((current->left != NULL && !enqueue(&queue, current->left)) ||
+		    (current->right != NULL && !enqueue(&queue, current->right)))
+			break;
 	}
 
 	/* free the queue */
@@ -3,40 +3,30 @@
 /**
  * binary_tree_is_complete - checks if a binary tree is complete
  * @tree: pointer to the root node of the tree to check
+ *
+ * Nodes are visited in level order; once a missing child has been seen,
+ * any further child means the tree is not complete.
  * Return: 1 if the tree is complete, 0 otherwise
  */
 int binary_tree_is_complete(const binary_tree_t *tree)
 {
-	binary_tree_t **queue = NULL, *current;
-	int front = 0, rear = 0;
-	int null_seen = 0;
+	queue_t *queue = NULL;
+	const binary_tree_t *current, *child;
+	int gap_seen = 0, x, complete = 1;
 
-	if (tree == NULL)
+	if (tree == NULL || !enqueue(&queue, tree))
 		return (0);
-	queue = malloc(sizeof(binary_tree_t *) * 1000);
-	if (queue == NULL)
-		return (0);
-	queue[rear++] = (binary_tree_t *)tree;
-	while (front < rear)
+	while (complete && (current = dequeue(&queue)) != NULL)
 	{
-		current = queue[front++];
-		if (current == NULL)
-			null_seen = 1;
-		else if (null_seen)
-		{
-			free(queue);
-			return (0);
-		}
-		else
+		for (x = 0; x < 2; x++)
 		{
-			queue = realloc(queue, sizeof(binary_tree_t *)
-					* (rear + 2));
-			if (queue == NULL)
-				return (0);
-			queue[rear++] = current->left;
-			queue[rear++] = current->right;
+			child = x == 0 ? current->left : current->right;
+			if (child == NULL)
+				gap_seen = 1;
+			else if (gap_seen || !enqueue(&queue, child))
+				complete = 0;
 		}
 	}
-	free(queue);
-	return (1);
+	free_queue(&queue);
+	return (complete);
 }
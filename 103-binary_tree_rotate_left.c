@@ -12,6 +12,7 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
 	if (tree == NULL || tree->right == NULL)
 		return (tree);
 
+	BT_COUNT(rotations, 1);
 	n_root = tree->right;
 	tree->right = n_root->left;
 
@@ -28,6 +29,8 @@ binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree)
 		tree->parent->right = n_root;
 	n_root->left = tree;
 	tree->parent = n_root;
+	node_update(tree);
+	node_update(n_root);
 
 	return (n_root);
 }
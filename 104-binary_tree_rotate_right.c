@@ -11,6 +11,7 @@ binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree)
 
 	if (tree == NULL || tree->left == NULL)
 		return (tree);
+	BT_COUNT(rotations, 1);
 	n_root = tree->left;
 	tree->left = n_root->right;
 
@@ -27,6 +28,8 @@ binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree)
 		tree->parent->left = n_root;
 	n_root->right = tree;
 	tree->parent = n_root;
+	node_update(tree);
+	node_update(n_root);
 
 	return (n_root);
 }
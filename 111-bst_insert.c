@@ -4,6 +4,9 @@
  * bst_insert - inserts a value into binary search tree (BST)
  * @tree: doble pointer to the root node of the BST
  * @value: value to store in the node to be inserted
+ *
+ * Description: the cached height and size of the ancestors of the new
+ * node are refreshed once it is linked in.
  * Return: pointer to the created node, or NULL on failure
  */
 bst_t *bst_insert(bst_t **tree, int value)
@@ -17,6 +20,8 @@ bst_t *bst_insert(bst_t **tree, int value)
 			return (NULL);
 		return (*tree);
 	}
+	BT_COUNT(visits, 1);
+	BT_COUNT(compares, 1 + (value >= (*tree)->n));
 	if (value < (*tree)->n)
 	{
 		if ((*tree)->left == NULL)
@@ -24,6 +29,8 @@ bst_t *bst_insert(bst_t **tree, int value)
 			(*tree)->left = binary_tree_node(*tree, value);
 			if ((*tree)->left == NULL)
 				return (NULL);
+			node_update_path(*tree);
+			BT_DEPTH(binary_tree_depth((*tree)->left));
 			return ((*tree)->left);
 		}
 		return (bst_insert(&((*tree)->left), value));
@@ -35,6 +42,8 @@ bst_t *bst_insert(bst_t **tree, int value)
 			(*tree)->right = binary_tree_node(*tree, value);
 			if ((*tree)->right == NULL)
 				return (NULL);
+			node_update_path(*tree);
+			BT_DEPTH(binary_tree_depth((*tree)->right));
 			return ((*tree)->right);
 		}
 		return (bst_insert(&((*tree)->right), value));
@@ -9,8 +9,14 @@
  */
 bst_t *bst_search(const bst_t *tree, int value)
 {
+	BT_COUNT(visits, tree != NULL);
+	BT_COUNT(compares, tree != NULL);
 	if (tree == NULL || tree->n == value)
+	{
+		BT_DEPTH(binary_tree_depth(tree));
 		return ((bst_t *)tree);
+	}
+	BT_COUNT(compares, 1);
 	if (value < tree->n)
 		return (bst_search(tree->left, value));
 	return (bst_search(tree->right, value));
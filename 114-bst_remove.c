@@ -33,21 +33,18 @@ bst_t *bst_remove(bst_t *root, int value)
 		root->right = bst_remove(root->right, value);
 	else
 	{
-		if (!root->left)
+		if (!root->left || !root->right)
 		{
-			tmpo = root->right;
-			free(root);
-			return (tmpo);
-		}
-		else if (!root->right)
-		{
-			tmpo = root->left;
-			free(root);
+			tmpo = root->left ? root->left : root->right;
+			if (tmpo)
+				tmpo->parent = root->parent;
+			tree_node_free(root);
 			return (tmpo);
 		}
 		tmpo = find_successor(root);
 		root->n = tmpo->n;
 		root->right = bst_remove(root->right, tmpo->n);
 	}
+	node_update(root);
 	return (root);
 }
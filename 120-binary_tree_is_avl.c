@@ -26,24 +26,16 @@ size_t height(const binary_tree_t *tree)
 /**
  * binary_tree_is_avl - checks if a binary tree is a valid AVL tree
  * @tree: pointer to the root node of the tree to check
+ *
+ * The tree may have been built by hand, so the cached heights are not
+ * trusted: binary_tree_stats() recomputes them in a single O(n) pass.
  * Return: 1 if tree is a valid AVL tree, 0 otherwise
  */
 int binary_tree_is_avl(const binary_tree_t *tree)
 {
-	size_t l_height, r_height, diff;
+	binary_tree_stats_t stats;
 
-	if (tree == NULL)
-		return (0);
-
-	l_height = height(tree->left);
-	r_height = height(tree->right);
-	diff = l_height > r_height ? l_height - r_height : r_height - l_height;
-
-	if (diff > 1)
-		return (0);
-
-	if (!binary_tree_is_avl(tree->left) ||
-			!binary_tree_is_avl(tree->right))
+	if (tree == NULL || !binary_tree_stats(tree, &stats))
 		return (0);
-	return (1);
+	return (stats.avl);
 }
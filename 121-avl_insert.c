@@ -1,22 +1,14 @@
 #include "binary_trees.h"
 
 /**
- * h_len - measures the height of the binary tree
+ * h_len - reads the height of the binary tree
  * @tree: pointer to the root node of the tree to measure the height
  * Return: if tree is NULL, your function must return 0, else
- * return h_len
+ * return the height cached in the node
  */
 size_t h_len(const binary_tree_t *tree)
 {
-	size_t l_len = 0, r_len = 0;
-
-	if (tree != NULL)
-	{
-		l_len = tree->left ? 1 + binary_tree_height(tree->left) : 1;
-		r_len = tree->right ? 1 + binary_tree_height(tree->right) : 1;
-		return ((l_len > r_len) ? 1 : r_len);
-	}
-	return (0);
+	return (node_height(tree));
 }
 
 /**
@@ -26,7 +18,9 @@ size_t h_len(const binary_tree_t *tree)
  */
 int b_lanc(const binary_tree_t *tree)
 {
-	return (tree != NULL ? h_len(tree->left) - h_len(tree->right) : 0);
+	if (tree == NULL)
+		return (0);
+	return (node_height(tree->left) - node_height(tree->right));
 }
 
 /**
@@ -44,6 +38,8 @@ avl_t *avl_in_recur(avl_t **tree, avl_t *parent, avl_t **nw, int value)
 	if (*tree == NULL)
 		return (*nw = binary_tree_node(parent, value));
 
+	BT_COUNT(visits, 1);
+	BT_COUNT(compares, 1 + ((*tree)->n <= value));
 	if ((*tree)->n > value)
 	{
 		(*tree)->left = avl_in_recur(&(*tree)->left, *tree,
@@ -60,11 +56,13 @@ avl_t *avl_in_recur(avl_t **tree, avl_t *parent, avl_t **nw, int value)
 	}
 	else
 		return (*tree);
+	node_update(*tree);
 	b_fact = b_lanc(*tree);
 	if (b_fact > 1 && (*tree)->left->n > value)
 		*tree = binary_tree_rotate_right(*tree);
 	else if (b_fact > 1 && (*tree)->left->n < value)
 	{
+		BT_COUNT(double_rotations, 1);
 		(*tree)->left = binary_tree_rotate_left((*tree)->left);
 		*tree = binary_tree_rotate_right(*tree);
 	}
@@ -72,6 +70,7 @@ avl_t *avl_in_recur(avl_t **tree, avl_t *parent, avl_t **nw, int value)
 		*tree = binary_tree_rotate_left(*tree);
 	else if (b_fact < -1 && (*tree)->right->n > value)
 	{
+		BT_COUNT(double_rotations, 1);
 		(*tree)->right = binary_tree_rotate_right((*tree)->right);
 		*tree = binary_tree_rotate_left(*tree);
 	}
@@ -95,5 +94,6 @@ avl_t *avl_insert(avl_t **tree, int value)
 	}
 
 	avl_in_recur(tree, *tree, &nw, value);
+	BT_DEPTH(binary_tree_depth(nw));
 	return (nw);
 }
@@ -8,38 +8,26 @@
  */
 int comp_int(const void *a, const void *b)
 {
-	return (*(int *)a - *(int *)b);
+	int x = *(const int *)a, y = *(const int *)b;
+
+	return ((x > y) - (x < y));
 }
 
 /**
  * array_to_avl - buildds an AVL tree from an array
  * @array: pointer to the first element of the array
  * @size: number of the elements in the array
+ *
+ * The array is sorted in place, then the tree is built directly from it
+ * by sorted_array_to_avl() instead of inserting values one by one.
  * Return: pointer to the root node of hte created AVL tree
  * or NULL on failure
  */
 avl_t *array_to_avl(int *array, size_t size)
 {
-	avl_t *root = NULL;
-	size_t x;
-
 	if (array == NULL || size == 0)
 		return (NULL);
 
 	qsort(array, size, sizeof(int), comp_int);
-	for (x = 0; x < size; x++)
-	{
-		/** for (y = 0; y < x; y++)
-		 * {
-		 * 	if (array[y] == array[x])
-		 * 		break;
-		 * }
-		 * if (y == x)
-		 * {
-		 */
-		if (avl_insert(&root, array[x]) == NULL)
-				return (NULL);
-		/* } */
-	}
-	return (root);
+	return (sorted_array_to_avl(array, size));
 }
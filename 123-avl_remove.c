@@ -0,0 +1,75 @@
+#include "binary_trees.h"
+
+/**
+ * avl_rebalance - restores the AVL property at a node
+ * @tree: pointer to the node, its children must be valid AVL trees
+ * whose heights differ by at most 2
+ * Return: pointer to the root of the subtree once balanced
+ */
+avl_t *avl_rebalance(avl_t *tree)
+{
+	int b_fact = b_lanc(tree);
+
+	if (b_fact > 1)
+	{
+		if (b_lanc(tree->left) < 0)
+			binary_tree_rotate_left(tree->left);
+		return (binary_tree_rotate_right(tree));
+	}
+	if (b_fact < -1)
+	{
+		if (b_lanc(tree->right) > 0)
+			binary_tree_rotate_right(tree->right);
+		return (binary_tree_rotate_left(tree));
+	}
+	return (tree);
+}
+
+/**
+ * avl_remove_recur - removes a value from an AVL subtree recursively
+ * @tree: pointer to the root node of the subtree
+ * @value: value to remove
+ * Return: pointer to the new root node of the subtree
+ */
+static avl_t *avl_remove_recur(avl_t *tree, int value)
+{
+	avl_t *tmpo;
+
+	if (tree == NULL)
+		return (NULL);
+	if (value < tree->n)
+		tree->left = avl_remove_recur(tree->left, value);
+	else if (value > tree->n)
+		tree->right = avl_remove_recur(tree->right, value);
+	else if (tree->left == NULL || tree->right == NULL)
+	{
+		tmpo = tree->left != NULL ? tree->left : tree->right;
+		if (tmpo != NULL)
+			tmpo->parent = tree->parent;
+		tree_node_free(tree);
+		return (tmpo);
+	}
+	else
+	{
+		for (tmpo = tree->right; tmpo->left != NULL; tmpo = tmpo->left)
+			;
+		tree->n = tmpo->n;
+		tree->right = avl_remove_recur(tree->right, tmpo->n);
+	}
+	node_update(tree);
+	return (avl_rebalance(tree));
+}
+
+/**
+ * avl_remove - removes a node from an AVL tree
+ * @root: pointer to the root node of the tree for removing a node
+ * @value: value to remove in the tree
+ *
+ * A node with two children is replaced by its in-order successor.
+ * Return: pointer to the new root node of the tree after removing
+ * the desired value, and after rebalancing
+ */
+avl_t *avl_remove(avl_t *root, int value)
+{
+	return (avl_remove_recur(root, value));
+}
@@ -0,0 +1,45 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ * @ac: argument count
+ * @av: optional av[1], number of keys for a timed bulk load
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    avl_t *tree;
+    int array[] = {
+        1, 2, 20, 21, 22, 32, 34, 47, 62, 68,
+        79, 84, 87, 91, 95, 98
+    };
+    size_t n = sizeof(array) / sizeof(array[0]), i;
+    int *big;
+    clock_t t;
+
+    tree = sorted_array_to_avl(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    if (ac < 2)
+        return (0);
+
+    n = strtoul(av[1], NULL, 10);
+    big = malloc(sizeof(int) * n);
+    if (!big)
+        return (1);
+    for (i = 0; i < n; i++)
+        big[i] = (int)i;
+    t = clock();
+    tree = sorted_array_to_avl(big, n);
+    printf("%lu keys loaded in %.3fs, height %d\n", (unsigned long)n,
+           (double)(clock() - t) / CLOCKS_PER_SEC, tree ? tree->height : 0);
+    binary_tree_delete(tree);
+    free(big);
+    return (0);
+}
@@ -0,0 +1,94 @@
+#include "binary_trees.h"
+
+/**
+ * build_recur - builds a perfectly balanced tree from a sorted range
+ * @array: pointer to the sorted, duplicate-free values
+ * @lo: index of the first value of the range
+ * @hi: index one past the last value of the range
+ * @parent: parent of the root of the range
+ * Return: pointer to the root of the subtree, or NULL on failure
+ */
+static avl_t *build_recur(const int *array, size_t lo, size_t hi,
+		avl_t *parent)
+{
+	size_t mid = lo + (hi - lo - 1) / 2;
+	avl_t *node = binary_tree_node(parent, array[mid]);
+
+	if (node == NULL)
+		return (NULL);
+	if (mid > lo)
+		node->left = build_recur(array, lo, mid, node);
+	if (mid + 1 < hi)
+		node->right = build_recur(array, mid + 1, hi, node);
+	if ((mid > lo && node->left == NULL) ||
+			(mid + 1 < hi && node->right == NULL))
+	{
+		binary_tree_delete(node);
+		return (NULL);
+	}
+	node_update(node);
+	return (node);
+}
+
+/**
+ * sorted_build - checks the order of an array and builds a tree from it
+ * @array: pointer to the values, in non-decreasing order
+ * @size: number of values
+ *
+ * Duplicates are dropped through a temporary compacted copy, so the
+ * caller's array is never modified.
+ * Return: pointer to the root of the tree, or NULL on failure or if
+ * the array is not sorted
+ */
+static avl_t *sorted_build(const int *array, size_t size)
+{
+	size_t x, uniq = 1;
+	int *copy;
+	avl_t *root;
+
+	if (array == NULL || size == 0)
+		return (NULL);
+	for (x = 1; x < size; x++)
+	{
+		if (array[x] < array[x - 1])
+			return (NULL);
+		uniq += array[x] != array[x - 1];
+	}
+	if (uniq == size)
+		return (build_recur(array, 0, size, NULL));
+	copy = malloc(sizeof(int) * uniq);
+	if (copy == NULL)
+		return (NULL);
+	for (copy[0] = array[0], uniq = 1, x = 1; x < size; x++)
+		if (array[x] != array[x - 1])
+			copy[uniq++] = array[x];
+	root = build_recur(copy, 0, uniq, NULL);
+	free(copy);
+	return (root);
+}
+
+/**
+ * sorted_array_to_avl - builds an AVL tree from a sorted array in O(n)
+ * @array: pointer to the first element of the array to be converted
+ * @size: number of element in the array
+ *
+ * The middle value becomes the root and each half is built the same
+ * way, so no rotation or search is ever needed.
+ * Return: pointer to the root node of the created AVL tree, or NULL on
+ * failure
+ */
+avl_t *sorted_array_to_avl(int *array, size_t size)
+{
+	return (sorted_build(array, size));
+}
+
+/**
+ * sorted_array_to_bst - builds a balanced BST from a sorted array in O(n)
+ * @array: pointer to the first element of the array to be converted
+ * @size: number of element in the array
+ * Return: pointer to the root node of the created BST, or NULL on failure
+ */
+bst_t *sorted_array_to_bst(int *array, size_t size)
+{
+	return (sorted_build(array, size));
+}
@@ -0,0 +1,44 @@
+#include "binary_trees.h"
+
+/**
+ * binary_tree_is_heap - checks if a binary tree is a valid Max Binary Heap
+ * @tree: pointer to the root node of the tree to check
+ *
+ * Description: the tree must be complete and no node may hold a value
+ * smaller than one of its children, both measured in one pass.
+ * Return: 1 if tree is a valid Max Binary Heap, 0 otherwise or if tree
+ * is NULL
+ */
+int binary_tree_is_heap(const binary_tree_t *tree)
+{
+	binary_tree_stats_t stats;
+
+	if (tree == NULL || !binary_tree_stats(tree, &stats))
+		return (0);
+	return (stats.heap);
+}
+
+/**
+ * heap_size - counts the nodes of a heap from the cached heights
+ * @root: pointer to the root node of the heap, a complete tree
+ *
+ * Description: when both subtrees of a node have the same height the left
+ * one is perfect, otherwise the right one is, one level shorter. Either
+ * way the perfect one holds 2^height - 1 nodes and only the other needs to
+ * be counted, so this is O(log n) with or without BT_ORDER_STATS.
+ * Return: number of nodes in the heap, 0 if root is NULL
+ */
+size_t heap_size(const heap_t *root)
+{
+	size_t size = 0;
+	int left, right;
+
+	while (root != NULL)
+	{
+		left = node_height(root->left);
+		right = node_height(root->right);
+		size += (size_t)1 << (left == right ? left : right);
+		root = left == right ? root->right : root->left;
+	}
+	return (size);
+}
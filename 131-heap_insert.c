@@ -0,0 +1,119 @@
+#include "binary_trees.h"
+
+/**
+ * heap_nth - finds a node of a heap by its level-order position
+ * @root: pointer to the root node of the heap
+ * @pos: one-based level-order position, 1 for the root
+ *
+ * Description: below the leading 1, the bits of pos spell the path from
+ * the root, 0 for left and 1 for right.
+ * Return: pointer to the node, or NULL if there is none at pos
+ */
+heap_t *heap_nth(const heap_t *root, size_t pos)
+{
+	size_t bit = 1;
+
+	if (pos == 0)
+		return (NULL);
+	while (bit <= pos / 2)
+		bit <<= 1;
+	for (bit >>= 1; bit != 0 && root != NULL; bit >>= 1)
+		root = pos & bit ? root->right : root->left;
+	return ((heap_t *)root);
+}
+
+/**
+ * heap_sift_up - moves the value of a node up until its parent is larger
+ * @node: pointer to the node
+ * Return: pointer to the node that holds the value in the end
+ */
+heap_t *heap_sift_up(heap_t *node)
+{
+	int tmp;
+
+	while (node->parent != NULL && node->n > node->parent->n)
+	{
+		tmp = node->n;
+		node->n = node->parent->n;
+		node->parent->n = tmp;
+		node = node->parent;
+	}
+	return (node);
+}
+
+/**
+ * heap_sift_down - moves the value of a node down until both of its
+ * children are smaller
+ * @node: pointer to the node
+ * Return: pointer to the node that holds the value in the end
+ */
+heap_t *heap_sift_down(heap_t *node)
+{
+	heap_t *big;
+	int tmp;
+
+	while (1)
+	{
+		big = node;
+		if (node->left != NULL && node->left->n > big->n)
+			big = node->left;
+		if (node->right != NULL && node->right->n > big->n)
+			big = node->right;
+		if (big == node)
+			return (node);
+		tmp = node->n;
+		node->n = big->n;
+		big->n = tmp;
+		node = big;
+	}
+}
+
+/**
+ * heap_insert - inserts a value into a Max Binary Heap
+ * @root: double pointer to the root node of the Heap
+ * @value: value to store in the node to be inserted
+ *
+ * Description: the new node takes the first free level-order position,
+ * found from heap_size in O(log n), then its value is sifted up.
+ * Return: pointer to the node holding value, or NULL on failure
+ */
+heap_t *heap_insert(heap_t **root, int value)
+{
+	heap_t *parent, *node;
+	size_t pos;
+
+	if (root == NULL)
+		return (NULL);
+	if (*root == NULL)
+		return (*root = binary_tree_node(NULL, value));
+	pos = heap_size(*root) + 1;
+	parent = heap_nth(*root, pos / 2);
+	node = binary_tree_node(parent, value);
+	if (node == NULL)
+		return (NULL);
+	if (pos & 1)
+		parent->right = node;
+	else
+		parent->left = node;
+	node_update_path(parent);
+	return (heap_sift_up(node));
+}
+
+/**
+ * heap_update - changes the value of a node of a Max Binary Heap
+ * @node: pointer to the node
+ * @value: new value, larger or smaller than the current one
+ * Return: pointer to the node holding value once the heap is restored
+ */
+heap_t *heap_update(heap_t *node, int value)
+{
+	int old;
+
+	if (node == NULL)
+		return (NULL);
+	old = node->n;
+	node->n = value;
+	if (value > old)
+		return (heap_sift_up(node));
+	return (heap_sift_down(node));
+}
@@ -0,0 +1,66 @@
+#include "binary_trees.h"
+
+/**
+ * heap_shape - builds a complete tree holding an array in level order
+ * @array: pointer to the first element of the array
+ * @size: number of elements in the array
+ * @nodes: array receiving the node of each position
+ * Return: 1 on success, 0 on failure (the nodes are freed)
+ */
+static int heap_shape(int *array, size_t size, heap_t **nodes)
+{
+	heap_t *parent;
+	size_t i;
+
+	for (i = 0; i < size; i++)
+	{
+		parent = i > 0 ? nodes[(i - 1) / 2] : NULL;
+		nodes[i] = binary_tree_node(parent, array[i]);
+		if (nodes[i] == NULL)
+		{
+			if (i > 0)
+				binary_tree_delete(nodes[0]);
+			return (0);
+		}
+		if (parent != NULL && i % 2 == 1)
+			parent->left = nodes[i];
+		else if (parent != NULL)
+			parent->right = nodes[i];
+	}
+	for (i = size; i-- > 0;)
+		node_update(nodes[i]);
+	return (1);
+}
+
+/**
+ * array_to_heap - builds a Max Binary Heap tree from an array
+ * @array: pointer to the first element of the array to be converted
+ * @size: number of element in the array
+ *
+ * Description: the values are laid out as a complete tree first, then
+ * every internal node is sifted down from the last one to the root, which
+ * is O(n) instead of the O(n log n) of inserting them one by one.
+ * Return: pointer to the root node of the created Binary Heap, or NULL
+ * on failure
+ */
+heap_t *array_to_heap(int *array, size_t size)
+{
+	heap_t **nodes, *root;
+	size_t i;
+
+	if (array == NULL || size == 0)
+		return (NULL);
+	nodes = malloc(sizeof(*nodes) * size);
+	if (nodes == NULL)
+		return (NULL);
+	if (!heap_shape(array, size, nodes))
+	{
+		free(nodes);
+		return (NULL);
+	}
+	for (i = size / 2; i-- > 0;)
+		heap_sift_down(nodes[i]);
+	root = nodes[0];
+	free(nodes);
+	return (root);
+}
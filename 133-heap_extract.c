@@ -0,0 +1,37 @@
+#include "binary_trees.h"
+
+/**
+ * heap_extract - extracts the root node of a Max Binary Heap
+ * @root: double pointer to the root node of heap
+ *
+ * Description: the last node in level order is found from heap_size, its
+ * value replaces the root's, it is freed and the new root value is sifted
+ * down, all in O(log n).
+ * Return: the value stored in the root node, or 0 on failure
+ */
+int heap_extract(heap_t **root)
+{
+	heap_t *last, *parent;
+	int value;
+
+	if (root == NULL || *root == NULL)
+		return (0);
+	value = (*root)->n;
+	last = heap_nth(*root, heap_size(*root));
+	if (last == *root)
+	{
+		tree_node_free(*root);
+		*root = NULL;
+		return (value);
+	}
+	parent = last->parent;
+	if (parent->right == last)
+		parent->right = NULL;
+	else
+		parent->left = NULL;
+	node_update_path(parent);
+	(*root)->n = last->n;
+	tree_node_free(last);
+	heap_sift_down(*root);
+	return (value);
+}
@@ -0,0 +1,38 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    heap_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    int extract;
+
+    tree = array_to_heap(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+
+    extract = heap_extract(&tree);
+    printf("Extracted: %d\n", extract);
+    binary_tree_print(tree);
+
+    extract = heap_extract(&tree);
+    printf("Extracted: %d\n", extract);
+    binary_tree_print(tree);
+
+    extract = heap_extract(&tree);
+    printf("Extracted: %d\n", extract);
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    return (0);
+}
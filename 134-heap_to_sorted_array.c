@@ -0,0 +1,29 @@
+#include "binary_trees.h"
+
+/**
+ * heap_to_sorted_array - converts a Binary Max Heap to a sorted array
+ * of integers
+ * @heap: pointer to the root node of the heap to convert, freed on
+ * success
+ * @size: address to store the size of the array
+ * Return: array sorted in descending order, or NULL on failure
+ */
+int *heap_to_sorted_array(heap_t *heap, size_t *size)
+{
+	int *array;
+	size_t i, n;
+
+	if (size == NULL)
+		return (NULL);
+	*size = 0;
+	if (heap == NULL)
+		return (NULL);
+	n = heap_size(heap);
+	array = malloc(sizeof(int) * n);
+	if (array == NULL)
+		return (NULL);
+	for (i = 0; i < n; i++)
+		array[i] = heap_extract(&heap);
+	*size = n;
+	return (array);
+}
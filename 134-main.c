@@ -0,0 +1,45 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_array - Prints an array of integers
+ *
+ * @array: The array to be printed
+ * @size: Size of the array
+ */
+void print_array(const int *array, size_t size)
+{
+    size_t i;
+
+    for (i = 0; i < size; ++i)
+        printf("(%03d)", array[i]);
+    printf("\n");
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    heap_t *tree;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+    int *sorted;
+    size_t sorted_size;
+
+    tree = array_to_heap(array, n);
+    if (!tree)
+        return (1);
+    print_array(array, n);
+    binary_tree_print(tree);
+    sorted = heap_to_sorted_array(tree, &sorted_size);
+    print_array(sorted, sorted_size);
+    free(sorted);
+    return (0);
+}
@@ -1,40 +1,22 @@
 #include "binary_trees.h"
 
-/**
- * binary_tree_height - measure the height of a binary tree
- * @tree: a pointer to the root node of the tree
- * Return: the height of the tree, 0 if @tree is NULL
- */
-size_t binary_tree_height(const binary_tree_t *tree)
-{
-	size_t left_height, right_height;
-	int v;
-
-	if (tree == NULL)
-		return (0);
-	left_height = binary_tree_height(tree->left);
-	right_height = binary_tree_height(tree->right);
-
-	v = (left_height > right_height ? left_height : right_height);
-
-	return (1 + v);
-}
-
 /**
  * binary_tree_balance - measure the balance factor of
  * a binary tree
  * @tree: a pointer to the root node of the tree
- * Return: the balance factor of the tree, 0 if NULL
+ * Return: the balance factor of the tree, 0 if NULL or if the subtrees
+ * cannot be measured for lack of memory
  */
 int binary_tree_balance(const binary_tree_t *tree)
 {
-	int left_height, right_height;
+	binary_tree_stats_t left, right;
 
 	if (tree == NULL)
 		return (0);
 
-	left_height = binary_tree_height(tree->left);
-	right_height = binary_tree_height(tree->right);
+	if (!binary_tree_stats(tree->left, &left) ||
+	    !binary_tree_stats(tree->right, &right))
+		return (0);
 
-	return (left_height - right_height);
+	return ((int)left.height - (int)right.height);
 }
@@ -0,0 +1,71 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * build - builds a BST out of pseudo-random keys
+ * @n: number of keys to insert
+ *
+ * Return: pointer to the root of the tree
+ */
+static bst_t *build(size_t n)
+{
+    bst_t *root = NULL;
+    size_t i;
+
+    srand(98);
+    for (i = 0; i < n; i++)
+        bst_insert(&root, (int)(((unsigned int)rand() << 15) ^ rand()));
+    return (root);
+}
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * main - compares malloc and slab pool allocation of tree nodes
+ * @ac: argument count
+ * @av: av[1] is the number of keys (default 1000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+    tree_pool_t *pool;
+    bst_t *tree;
+    clock_t t;
+
+    t = clock();
+    tree = build(n);
+    printf("malloc: build %.3fs", seconds(t));
+    t = clock();
+    binary_tree_delete(tree);
+    printf(", delete %.3fs\n", seconds(t));
+
+    pool = tree_pool_create(0);
+    if (!pool)
+        return (1);
+    tree_alloc_set(&pool->alloc);
+    t = clock();
+    tree = build(n);
+    printf("pool:   build %.3fs", seconds(t));
+    t = clock();
+    binary_tree_delete(tree);
+    printf(", delete %.3fs", seconds(t));
+    tree = build(n);
+    printf(" (%lu live nodes)", (unsigned long)pool->live);
+    t = clock();
+    tree_pool_destroy(pool);
+    printf(", bulk teardown %.3fs\n", seconds(t));
+    return (0);
+}
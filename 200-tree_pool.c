@@ -0,0 +1,99 @@
+#include "binary_trees.h"
+
+/**
+ * pool_alloc - hands out one node from a pool
+ * @ctx: the tree_pool_t the node is taken from
+ * Return: pointer to the node storage, or NULL on failure
+ */
+static void *pool_alloc(void *ctx)
+{
+	tree_pool_t *pool = ctx;
+	binary_tree_t *node = pool->free_list;
+	tree_slab_t *slab;
+
+	if (node != NULL)
+	{
+		pool->free_list = node->left;
+		pool->live++;
+		return (node);
+	}
+	slab = pool->slabs;
+	if (slab == NULL || slab->used == pool->per_slab)
+	{
+		slab = malloc(sizeof(tree_slab_t) +
+				pool->per_slab * sizeof(binary_tree_t));
+		if (slab == NULL)
+			return (NULL);
+		slab->used = 0;
+		slab->next = pool->slabs;
+		pool->slabs = slab;
+	}
+	node = (binary_tree_t *)(slab + 1) + slab->used++;
+	pool->live++;
+	return (node);
+}
+
+/**
+ * pool_free - gives one node back to its pool for reuse
+ * @ctx: the tree_pool_t the node came from
+ * @ptr: node to recycle
+ */
+static void pool_free(void *ctx, void *ptr)
+{
+	tree_pool_t *pool = ctx;
+	binary_tree_t *node = ptr;
+
+	node->left = pool->free_list;
+	pool->free_list = node;
+	pool->live--;
+}
+
+/**
+ * tree_pool_create - creates a slab pool of tree nodes
+ * @per_slab: number of nodes per slab, 0 picks a default
+ *
+ * Select it with tree_alloc_set(&pool->alloc) before building a tree.
+ * Return: pointer to the new pool, or NULL on failure
+ */
+tree_pool_t *tree_pool_create(size_t per_slab)
+{
+	tree_pool_t *pool = malloc(sizeof(tree_pool_t));
+
+	if (pool == NULL)
+		return (NULL);
+	pool->slabs = NULL;
+	pool->free_list = NULL;
+	pool->per_slab = per_slab ? per_slab : 4096;
+	pool->live = 0;
+	pool->alloc.alloc = pool_alloc;
+	pool->alloc.free = pool_free;
+	pool->alloc.ctx = pool;
+	return (pool);
+}
+
+/**
+ * tree_pool_destroy - releases a pool and every node carved from it
+ * @pool: pool to destroy, may be NULL
+ *
+ * Trees built from the pool die with it, without walking them, so
+ * there is no need to call binary_tree_delete() on them first.
+ * If the pool is the calling thread's allocator, malloc/free is restored
+ * for that thread; other threads must not have it selected anymore.
+ */
+void tree_pool_destroy(tree_pool_t *pool)
+{
+	tree_slab_t *slab, *next;
+	tree_alloc_t *prev;
+
+	if (pool == NULL)
+		return;
+	prev = tree_alloc_set(NULL);
+	if (prev != &pool->alloc)
+		tree_alloc_set(prev);
+	for (slab = pool->slabs; slab != NULL; slab = next)
+	{
+		next = slab->next;
+		free(slab);
+	}
+	free(pool);
+}
@@ -0,0 +1,137 @@
+#include "binary_trees.h"
+
+/**
+ * avl_retrace - refreshes heights and rebalances from a node up to the root
+ * @tree: pointer to the lowest node that may be out of date
+ * Return: pointer to the root node of the whole tree
+ */
+avl_t *avl_retrace(avl_t *tree)
+{
+	avl_t *root = tree;
+
+	while (tree != NULL)
+	{
+		node_update(tree);
+		tree = avl_rebalance(tree);
+		root = tree;
+		tree = tree->parent;
+	}
+	return (root);
+}
+
+/**
+ * join_right - joins when @left is more than one level taller than @right
+ * @left: pointer to the root of the taller tree
+ * @mid: detached node whose value lies between both trees
+ * @right: pointer to the root of the shorter tree
+ * Return: pointer to the root of the joined tree
+ */
+static avl_t *join_right(avl_t *left, avl_t *mid, avl_t *right)
+{
+	avl_t *parent = NULL, *tmpo = left;
+
+	while (node_height(tmpo) > node_height(right) + 1)
+	{
+		parent = tmpo;
+		tmpo = tmpo->right;
+	}
+	mid->left = tmpo;
+	mid->right = right;
+	mid->parent = parent;
+	parent->right = mid;
+	if (tmpo != NULL)
+		tmpo->parent = mid;
+	if (right != NULL)
+		right->parent = mid;
+	return (avl_retrace(mid));
+}
+
+/**
+ * join_left - joins when @right is more than one level taller than @left
+ * @left: pointer to the root of the shorter tree
+ * @mid: detached node whose value lies between both trees
+ * @right: pointer to the root of the taller tree
+ * Return: pointer to the root of the joined tree
+ */
+static avl_t *join_left(avl_t *left, avl_t *mid, avl_t *right)
+{
+	avl_t *parent = NULL, *tmpo = right;
+
+	while (node_height(tmpo) > node_height(left) + 1)
+	{
+		parent = tmpo;
+		tmpo = tmpo->left;
+	}
+	mid->left = left;
+	mid->right = tmpo;
+	mid->parent = parent;
+	parent->left = mid;
+	if (tmpo != NULL)
+		tmpo->parent = mid;
+	if (left != NULL)
+		left->parent = mid;
+	return (avl_retrace(mid));
+}
+
+/**
+ * avl_join - joins two AVL trees around a middle node
+ * @left: pointer to the root of a tree whose values are all below @mid
+ * @mid: detached node to put between both trees
+ * @right: pointer to the root of a tree whose values are all above @mid
+ *
+ * Runs in O(|height(left) - height(right)| + 1).
+ * Return: pointer to the root of the joined tree
+ */
+avl_t *avl_join(avl_t *left, avl_t *mid, avl_t *right)
+{
+	if (left != NULL)
+		left->parent = NULL;
+	if (right != NULL)
+		right->parent = NULL;
+	if (node_height(left) > node_height(right) + 1)
+		return (join_right(left, mid, right));
+	if (node_height(right) > node_height(left) + 1)
+		return (join_left(left, mid, right));
+	mid->left = left;
+	mid->right = right;
+	mid->parent = NULL;
+	if (left != NULL)
+		left->parent = mid;
+	if (right != NULL)
+		right->parent = mid;
+	node_update(mid);
+	return (mid);
+}
+
+/**
+ * avl_join2 - joins two AVL trees without a middle node
+ * @left: pointer to the root of a tree whose values are all below @right
+ * @right: pointer to the root of the other tree
+ *
+ * The largest node of @left is detached and used as the middle node.
+ * Return: pointer to the root of the joined tree
+ */
+avl_t *avl_join2(avl_t *left, avl_t *right)
+{
+	avl_t *mid, *parent;
+
+	if (left != NULL)
+		left->parent = NULL;
+	if (right != NULL)
+		right->parent = NULL;
+	if (left == NULL || right == NULL)
+		return (left != NULL ? left : right);
+	for (mid = left; mid->right != NULL; mid = mid->right)
+		;
+	parent = mid->parent;
+	if (mid->left != NULL)
+		mid->left->parent = parent;
+	if (parent == NULL)
+		left = mid->left;
+	else
+	{
+		parent->right = mid->left;
+		left = avl_retrace(parent);
+	}
+	return (avl_join(left, mid, right));
+}
@@ -0,0 +1,51 @@
+#include "binary_trees.h"
+
+/**
+ * batch_recur - removes a sorted run of values from an AVL subtree
+ * @tree: pointer to the root node of the subtree
+ * @values: sorted values to remove, duplicates allowed
+ * @size: number of values
+ *
+ * Each affected node is rejoined once with its rebuilt children, so the
+ * whole batch costs O(k log(n / k + 1)) instead of k separate removals.
+ * Return: pointer to the new root of the subtree, its parent is NULL
+ */
+static avl_t *batch_recur(avl_t *tree, int *values, size_t size)
+{
+	size_t lo = 0, hi = size, end;
+	avl_t *left, *right;
+
+	if (tree == NULL || size == 0)
+		return (tree);
+	while (lo < hi)
+	{
+		end = lo + (hi - lo) / 2;
+		if (values[end] < tree->n)
+			lo = end + 1;
+		else
+			hi = end;
+	}
+	for (end = lo; end < size && values[end] == tree->n; end++)
+		;
+	left = batch_recur(tree->left, values, lo);
+	right = batch_recur(tree->right, values + end, size - end);
+	if (end == lo)
+		return (avl_join(left, tree, right));
+	tree_node_free(tree);
+	return (avl_join2(left, right));
+}
+
+/**
+ * avl_remove_batch - removes many values from an AVL tree at once
+ * @root: pointer to the root node of the tree
+ * @values: values to remove, sorted in place; absent values are ignored
+ * @size: number of values
+ * Return: pointer to the new root node of the tree
+ */
+avl_t *avl_remove_batch(avl_t *root, int *values, size_t size)
+{
+	if (root == NULL || values == NULL || size == 0)
+		return (root);
+	qsort(values, size, sizeof(int), comp_int);
+	return (batch_recur(root, values, size));
+}
@@ -0,0 +1,126 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * max_avl_height - largest height an AVL tree of a given size can have
+ * @size: number of nodes
+ *
+ * Return: the bound, from the minimal node counts N(h) = N(h-1) + N(h-2) + 1
+ */
+static int max_avl_height(size_t size)
+{
+    size_t a = 0, b = 1, c;
+    int h = 1;
+
+    while (1)
+    {
+        c = a + b + 1;
+        if (c > size)
+            return (h);
+        a = b;
+        b = c;
+        h++;
+    }
+}
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * churn - replaces a batch of keys, either one by one or in a batch
+ * @tree: pointer to the root of the tree
+ * @keys: live keys, the batch is replaced in place
+ * @batch: number of keys to replace
+ * @next: next fresh key
+ * @bulk: 1 to use avl_remove_batch, 0 for one avl_remove per key
+ * @spent: time spent removing keys is added to it
+ *
+ * Return: the new root, or NULL if the batch cannot be copied
+ */
+static avl_t *churn(avl_t *tree, int *keys, size_t batch, int *next,
+                    int bulk, double *spent)
+{
+    int *gone = malloc(sizeof(int) * batch);
+    size_t i;
+    clock_t t;
+
+    if (!gone)
+        return (NULL);
+    for (i = 0; i < batch; i++)
+        gone[i] = keys[i];
+    t = clock();
+    if (bulk)
+        tree = avl_remove_batch(tree, gone, batch);
+    else
+        for (i = 0; i < batch; i++)
+            tree = avl_remove(tree, gone[i]);
+    *spent += seconds(t);
+    for (i = 0; i < batch; i++)
+    {
+        keys[i] = (*next)++;
+        avl_insert(&tree, keys[i]);
+    }
+    free(gone);
+    return (tree);
+}
+
+/**
+ * main - churn benchmark: removes and reinserts keys, checking the height
+ * @ac: argument count
+ * @av: av[1] is the tree size, av[2] the batch size, av[3] the rounds
+ *
+ * Return: 0 if the tree stayed a bounded AVL tree, 1 otherwise
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+    size_t batch = ac > 2 ? strtoul(av[2], NULL, 10) : 10000;
+    size_t rounds = ac > 3 ? strtoul(av[3], NULL, 10) : 20, i, r, j;
+    avl_t *tree = NULL;
+    int *keys = malloc(sizeof(int) * n), next = 0, bulk, tmp;
+    double spent;
+
+    if (!keys)
+        return (1);
+    for (bulk = 0; bulk < 2; bulk++)
+    {
+        srand(402);
+        for (next = 0, i = 0; i < n; i++)
+            keys[i] = next++, avl_insert(&tree, keys[i]);
+        spent = 0;
+        for (r = 0; r < rounds; r++)
+        {
+            for (i = 0; i < batch; i++)
+            {
+                j = i + (size_t)rand() % (n - i);
+                tmp = keys[i], keys[i] = keys[j], keys[j] = tmp;
+            }
+            tree = churn(tree, keys, batch, &next, bulk, &spent);
+            if (!tree)
+                return (1);
+            if (tree->height > max_avl_height(n) || !binary_tree_is_avl(tree))
+            {
+                printf("round %lu: height %d out of bounds\n",
+                       (unsigned long)r, tree->height);
+                return (1);
+            }
+        }
+        printf("%s: %.3fs removing, height %d (bound %d)\n",
+               bulk ? "avl_remove_batch" : "avl_remove      ",
+               spent, tree->height, max_avl_height(n));
+        binary_tree_delete(tree);
+        tree = NULL;
+    }
+    free(keys);
+    return (0);
+}
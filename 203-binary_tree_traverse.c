@@ -0,0 +1,78 @@
+#include "binary_trees.h"
+
+/**
+ * inorder_first - finds the first node of an in-order traversal
+ * @root: pointer to the root node of the tree
+ * Return: pointer to the leftmost node, or NULL if root is NULL
+ */
+const binary_tree_t *inorder_first(const binary_tree_t *root)
+{
+	while (root != NULL && root->left != NULL)
+		root = root->left;
+	return (root);
+}
+
+/**
+ * inorder_next - steps an in-order traversal using the parent links
+ * @node: pointer to the current node
+ * @root: pointer to the root node of the traversed (sub)tree
+ * Return: pointer to the next node, or NULL when the traversal is over
+ */
+const binary_tree_t *inorder_next(const binary_tree_t *node,
+		const binary_tree_t *root)
+{
+	if (node->right != NULL)
+		return (inorder_first(node->right));
+	while (node != root && node == node->parent->right)
+		node = node->parent;
+	return (node == root ? NULL : node->parent);
+}
+
+/**
+ * preorder_next - steps a pre-order traversal using the parent links
+ * @node: pointer to the current node
+ * @root: pointer to the root node of the traversed (sub)tree
+ * Return: pointer to the next node, or NULL when the traversal is over
+ */
+const binary_tree_t *preorder_next(const binary_tree_t *node,
+		const binary_tree_t *root)
+{
+	if (node->left != NULL)
+		return (node->left);
+	if (node->right != NULL)
+		return (node->right);
+	for (; node != root; node = node->parent)
+	{
+		if (node == node->parent->left && node->parent->right != NULL)
+			return (node->parent->right);
+	}
+	return (NULL);
+}
+
+/**
+ * postorder_first - finds the first node of a post-order traversal
+ * @root: pointer to the root node of the tree
+ * Return: pointer to the first leaf reached going left first, or NULL
+ */
+const binary_tree_t *postorder_first(const binary_tree_t *root)
+{
+	while (root != NULL && (root->left != NULL || root->right != NULL))
+		root = root->left != NULL ? root->left : root->right;
+	return (root);
+}
+
+/**
+ * postorder_next - steps a post-order traversal using the parent links
+ * @node: pointer to the current node
+ * @root: pointer to the root node of the traversed (sub)tree
+ * Return: pointer to the next node, or NULL when the traversal is over
+ */
+const binary_tree_t *postorder_next(const binary_tree_t *node,
+		const binary_tree_t *root)
+{
+	if (node == root)
+		return (NULL);
+	if (node == node->parent->left && node->parent->right != NULL)
+		return (postorder_first(node->parent->right));
+	return (node->parent);
+}
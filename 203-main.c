@@ -0,0 +1,84 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+static long sum;
+
+/**
+ * sink - callback that keeps the traversal from being optimized out
+ * @n: value of the visited node
+ */
+static void sink(int n)
+{
+    sum += n;
+}
+
+/**
+ * recursive_inorder - the former recursive in-order traversal
+ * @tree: pointer to the root node of the tree to traverse
+ * @func: function to call for each node
+ */
+static void recursive_inorder(const binary_tree_t *tree, void (*func)(int))
+{
+    if (tree == NULL)
+        return;
+    recursive_inorder(tree->left, func);
+    func(tree->n);
+    recursive_inorder(tree->right, func);
+}
+
+/**
+ * bench - times the recursive and the parent-link in-order traversals
+ * @name: label of the tree shape
+ * @tree: pointer to the root node of the tree
+ * @recurse: 1 to also time the recursive traversal
+ */
+static void bench(const char *name, const binary_tree_t *tree, int recurse)
+{
+    clock_t t;
+
+    printf("%-10s", name);
+    if (recurse)
+    {
+        t = clock();
+        recursive_inorder(tree, sink);
+        printf(" recursive %.3fs,", (double)(clock() - t) / CLOCKS_PER_SEC);
+    }
+    t = clock();
+    binary_tree_inorder(tree, sink);
+    printf(" parent links %.3fs\n", (double)(clock() - t) / CLOCKS_PER_SEC);
+}
+
+/**
+ * main - compares recursive and parent-link traversals
+ * @ac: argument count
+ * @av: av[1] balanced tree size (default 1000000), av[2] degenerate tree
+ * size (default 100000), av[3] any value to skip the recursive traversal
+ * of the degenerate tree, which overflows the stack when it is deep enough
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000, i;
+    size_t d = ac > 2 ? strtoul(av[2], NULL, 10) : 100000;
+    int *keys = malloc(sizeof(int) * (n > d ? n : d));
+    binary_tree_t *tree, *tail;
+
+    if (!keys || !d)
+        return (1);
+    for (i = 0; i < n || i < d; i++)
+        keys[i] = (int)i;
+    tree = sorted_array_to_bst(keys, n);
+    bench("balanced", tree, 1);
+    binary_tree_delete(tree);
+
+    tree = tail = binary_tree_node(NULL, 0);
+    for (i = 1; i < d && tail; i++)
+        tail = tail->right = binary_tree_node(tail, keys[i]);
+    bench("degenerate", tree, ac < 4);
+    binary_tree_delete(tree);
+    free(keys);
+    return (sum == 0);
+}
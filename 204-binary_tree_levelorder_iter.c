@@ -0,0 +1,62 @@
+#include "binary_trees.h"
+
+/**
+ * levelorder_iter_init - starts a level-order iteration
+ * @iter: pointer to the iterator to initialize
+ * @tree: pointer to the root node of the tree to iterate over
+ * Return: 1 on success, 0 on failure
+ */
+int levelorder_iter_init(levelorder_iter_t *iter, const binary_tree_t *tree)
+{
+	iter->queue = NULL;
+	iter->remaining = 0;
+	iter->level = (size_t)-1;
+	if (tree == NULL)
+		return (1);
+	return (enqueue(&iter->queue, tree));
+}
+
+/**
+ * levelorder_iter_next - returns the next node in level order
+ * @iter: pointer to the iterator
+ * @new_level: if not NULL, set to 1 when the returned node is the first
+ * of its level, and to 0 otherwise; iter->level holds its depth
+ * Return: pointer to the next node, or NULL when the iteration is over
+ * or a queue allocation failed
+ */
+const binary_tree_t *levelorder_iter_next(levelorder_iter_t *iter,
+		int *new_level)
+{
+	const binary_tree_t *node;
+	int first = 0;
+
+	if (iter->queue == NULL || iter->queue->count == 0)
+		return (NULL);
+	if (iter->remaining == 0)
+	{
+		iter->remaining = iter->queue->count;
+		iter->level++;
+		first = 1;
+	}
+	node = dequeue(&iter->queue);
+	iter->remaining--;
+	if ((node->left != NULL && !enqueue(&iter->queue, node->left)) ||
+			(node->right != NULL && !enqueue(&iter->queue, node->right)))
+	{
+		levelorder_iter_free(iter);
+		return (NULL);
+	}
+	if (new_level != NULL)
+		*new_level = first;
+	return (node);
+}
+
+/**
+ * levelorder_iter_free - releases the resources held by an iterator
+ * @iter: pointer to the iterator, it may be stopped at any point
+ */
+void levelorder_iter_free(levelorder_iter_t *iter)
+{
+	free_queue(&iter->queue);
+	iter->remaining = 0;
+}
@@ -0,0 +1,83 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+static long sum;
+
+/**
+ * sink - callback that keeps the traversal from being optimized out
+ * @n: value of the visited node
+ */
+static void sink(int n)
+{
+    sum += n;
+}
+
+/**
+ * print_levels - prints a tree one level per line
+ * @tree: pointer to the root node of the tree
+ */
+static void print_levels(const binary_tree_t *tree)
+{
+    levelorder_iter_t iter;
+    const binary_tree_t *node;
+    int new_level;
+
+    if (!levelorder_iter_init(&iter, tree))
+        return;
+    while ((node = levelorder_iter_next(&iter, &new_level)) != NULL)
+    {
+        if (new_level)
+            printf("%sLevel %lu:", iter.level ? "\n" : "",
+                   (unsigned long)iter.level);
+        printf(" %d", node->n);
+    }
+    printf("\n");
+    levelorder_iter_free(&iter);
+}
+
+/**
+ * main - Entry point
+ * @ac: argument count
+ * @av: optional av[1], size of a tree to time a level-order walk on
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    binary_tree_t *root;
+    int *keys;
+    size_t n, i;
+    clock_t t;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    root->left->left = binary_tree_node(root->left, 6);
+    root->left->right = binary_tree_node(root->left, 56);
+    root->right->left = binary_tree_node(root->right, 256);
+    root->right->right = binary_tree_node(root->right, 512);
+    root->left->left->left = binary_tree_node(root->left->left, 1);
+    binary_tree_print(root);
+    print_levels(root);
+    binary_tree_delete(root);
+    if (ac < 2)
+        return (0);
+
+    n = strtoul(av[1], NULL, 10);
+    keys = malloc(sizeof(int) * n);
+    if (!keys)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i;
+    root = sorted_array_to_bst(keys, n);
+    free(keys);
+    t = clock();
+    binary_tree_levelorder(root, sink);
+    printf("level order over %lu nodes: %.3fs, complete: %d\n",
+           (unsigned long)n, (double)(clock() - t) / CLOCKS_PER_SEC,
+           binary_tree_is_complete(root));
+    binary_tree_delete(root);
+    return (0);
+}
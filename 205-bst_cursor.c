@@ -0,0 +1,61 @@
+#include "binary_trees.h"
+
+/**
+ * inorder_last - finds the last node of an in-order traversal
+ * @root: pointer to the root node of the tree
+ * Return: pointer to the rightmost node, or NULL if root is NULL
+ */
+const binary_tree_t *inorder_last(const binary_tree_t *root)
+{
+	while (root != NULL && root->right != NULL)
+		root = root->right;
+	return (root);
+}
+
+/**
+ * inorder_prev - steps an in-order traversal backwards using the parent
+ * links, the mirror of inorder_next
+ * @node: pointer to the current node
+ * @root: pointer to the root node of the traversed (sub)tree
+ * Return: pointer to the previous node, or NULL when the traversal is over
+ */
+const binary_tree_t *inorder_prev(const binary_tree_t *node,
+		const binary_tree_t *root)
+{
+	if (node->left != NULL)
+		return (inorder_last(node->left));
+	while (node != root && node == node->parent->left)
+		node = node->parent;
+	return (node == root ? NULL : node->parent);
+}
+
+/**
+ * bst_cursor_next - moves a cursor to the next node in order
+ * @cursor: pointer to the cursor
+ *
+ * Amortized O(1): a full scan crosses every edge twice. The walk never
+ * climbs above the root the cursor was opened on.
+ * Return: pointer to the new node under the cursor, NULL past the end
+ */
+bst_t *bst_cursor_next(bst_cursor_t *cursor)
+{
+	if (cursor->node != NULL)
+		cursor->node = (bst_t *)inorder_next(cursor->node, cursor->root);
+	return (cursor->node);
+}
+
+/**
+ * bst_cursor_prev - moves a cursor to the previous node in order
+ * @cursor: pointer to the cursor
+ *
+ * From past the end, the cursor moves to the largest node.
+ * Return: pointer to the new node under the cursor, NULL before the start
+ */
+bst_t *bst_cursor_prev(bst_cursor_t *cursor)
+{
+	if (cursor->node != NULL)
+		cursor->node = (bst_t *)inorder_prev(cursor->node, cursor->root);
+	else
+		cursor->node = (bst_t *)inorder_last(cursor->root);
+	return (cursor->node);
+}
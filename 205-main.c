@@ -0,0 +1,68 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include "binary_trees.h"
+
+/**
+ * print_num - prints a number
+ * @n: number to print
+ */
+void print_num(int n)
+{
+    printf(" %d", n);
+}
+
+/**
+ * main - Entry point
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(void)
+{
+    bst_t *tree;
+    bst_cursor_t cursor;
+    bst_t *node;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]), count;
+
+    tree = array_to_bst(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+
+    printf("Forward:");
+    bst_cursor_init(&cursor, tree);
+    for (node = cursor.node; node; node = bst_cursor_next(&cursor))
+        printf(" %d", node->n);
+    printf("\nBackward:");
+    for (node = bst_cursor_prev(&cursor); node; node = bst_cursor_prev(&cursor))
+        printf(" %d", node->n);
+
+    node = bst_cursor_lower_bound(&cursor, 50);
+    printf("\nlower_bound(50): %d", node->n);
+    node = bst_cursor_upper_bound(&cursor, 62);
+    printf("\nupper_bound(62): %d", node->n);
+    node = bst_cursor_seek(&cursor, 33);
+    printf("\nseek(33): %s", node ? "found" : "not found");
+    node = bst_cursor_seek(&cursor, 34);
+    printf("\nseek(34), then 3 steps:");
+    for (n = 0; node && n < 3; n++, node = bst_cursor_next(&cursor))
+        printf(" %d", node->n);
+
+    printf("\nRange [20, 70]:");
+    count = bst_range(tree, 20, 70, print_num);
+    printf("\n%lu values in range\n", (unsigned long)count);
+
+    printf("Subtree of %d:", tree->left->n);
+    bst_cursor_init(&cursor, tree->left);
+    for (node = cursor.node; node; node = bst_cursor_next(&cursor))
+        printf(" %d", node->n);
+    printf("\nBackward:");
+    for (node = bst_cursor_prev(&cursor); node; node = bst_cursor_prev(&cursor))
+        printf(" %d", node->n);
+    printf("\n");
+    binary_tree_delete(tree);
+    return (0);
+}
@@ -0,0 +1,94 @@
+#include "binary_trees.h"
+
+/**
+ * bst_cursor_init - points a cursor at the smallest node of a tree
+ * @cursor: pointer to the cursor to initialize
+ * @root: pointer to the root node of the BST
+ */
+void bst_cursor_init(bst_cursor_t *cursor, const bst_t *root)
+{
+	cursor->root = root;
+	cursor->node = (bst_t *)inorder_first(root);
+}
+
+/**
+ * bst_cursor_seek - moves a cursor to the node holding a value
+ * @cursor: pointer to the cursor
+ * @value: value to look for
+ * Return: pointer to the node, or NULL (past the end) if it is absent
+ */
+bst_t *bst_cursor_seek(bst_cursor_t *cursor, int value)
+{
+	cursor->node = bst_search(cursor->root, value);
+	return (cursor->node);
+}
+
+/**
+ * bst_cursor_lower_bound - moves a cursor to the first node >= value
+ * @cursor: pointer to the cursor
+ * @value: lower bound
+ * Return: pointer to the node, or NULL if every value is below @value
+ */
+bst_t *bst_cursor_lower_bound(bst_cursor_t *cursor, int value)
+{
+	const bst_t *node = cursor->root, *found = NULL;
+
+	while (node != NULL)
+	{
+		if (node->n >= value)
+		{
+			found = node;
+			node = node->left;
+		}
+		else
+			node = node->right;
+	}
+	cursor->node = (bst_t *)found;
+	return (cursor->node);
+}
+
+/**
+ * bst_cursor_upper_bound - moves a cursor to the first node > value
+ * @cursor: pointer to the cursor
+ * @value: strict lower bound
+ * Return: pointer to the node, or NULL if no value is above @value
+ */
+bst_t *bst_cursor_upper_bound(bst_cursor_t *cursor, int value)
+{
+	const bst_t *node = cursor->root, *found = NULL;
+
+	while (node != NULL)
+	{
+		if (node->n > value)
+		{
+			found = node;
+			node = node->left;
+		}
+		else
+			node = node->right;
+	}
+	cursor->node = (bst_t *)found;
+	return (cursor->node);
+}
+
+/**
+ * bst_range - visits every value in [lo, hi] in order
+ * @root: pointer to the root node of the BST
+ * @lo: smallest value to visit
+ * @hi: largest value to visit
+ * @func: function to call for each value, may be NULL to only count
+ * Return: number of values visited, in O(log n + k)
+ */
+size_t bst_range(const bst_t *root, int lo, int hi, void (*func)(int))
+{
+	bst_cursor_t cursor;
+	size_t count = 0;
+
+	bst_cursor_init(&cursor, root);
+	bst_cursor_lower_bound(&cursor, lo);
+	for (; cursor.node != NULL && cursor.node->n <= hi;
+			bst_cursor_next(&cursor), count++)
+		if (func != NULL)
+			func(cursor.node->n);
+	return (count);
+}
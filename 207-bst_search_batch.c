@@ -0,0 +1,64 @@
+#include "binary_trees.h"
+
+/* number of lookups kept in flight at once */
+#define BST_BATCH_LANES 16
+
+/**
+ * struct bst_lane_s - one lookup in flight
+ * @node: node to compare against on the next step
+ * @idx: index of the key being looked up
+ */
+typedef struct bst_lane_s
+{
+	const bst_t *node;
+	size_t idx;
+} bst_lane_t;
+
+/**
+ * bst_search_batch - searches many values in a BST at once
+ * @tree: pointer to the root node of the BST to search
+ * @keys: values to search
+ * @size: number of values
+ * @out: out[i] receives the node holding keys[i], or NULL if absent
+ *
+ * Up to BST_BATCH_LANES lookups advance in turn, one level each, and
+ * every lane prefetches its next node before yielding, so the cache
+ * misses of different lookups overlap instead of stalling one by one.
+ * A lane that finishes takes the next key right away.
+ */
+void bst_search_batch(const bst_t *tree, const int *keys, size_t size,
+		bst_t **out)
+{
+	bst_lane_t lanes[BST_BATCH_LANES];
+	size_t next = 0, active = 0, x;
+	const bst_t *node;
+
+	for (; active < BST_BATCH_LANES && next < size; active++, next++)
+	{
+		lanes[active].node = tree;
+		lanes[active].idx = next;
+	}
+	while (active > 0)
+	{
+		for (x = 0; x < active; x++)
+		{
+			node = lanes[x].node;
+			if (node != NULL && node->n != keys[lanes[x].idx])
+			{
+				node = keys[lanes[x].idx] < node->n ?
+					node->left : node->right;
+				lanes[x].node = node;
+				BST_PREFETCH(node);
+				continue;
+			}
+			out[lanes[x].idx] = (bst_t *)node;
+			if (next < size)
+			{
+				lanes[x].node = tree;
+				lanes[x].idx = next++;
+			}
+			else
+				lanes[x--] = lanes[--active];
+		}
+	}
+}
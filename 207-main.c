@@ -0,0 +1,79 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * random_key - draws a pseudo-random key
+ *
+ * Return: the key
+ */
+static int random_key(void)
+{
+    return ((int)((((unsigned int)rand() << 15) ^ rand()) & 0x3fffffff));
+}
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * main - compares bst_search with bst_search_batch for batch sizes 1-64
+ * @ac: argument count
+ * @av: av[1] tree size (default 2000000), av[2] lookups (default 4000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 2000000;
+    size_t q = ac > 2 ? strtoul(av[2], NULL, 10) : 4000000, i, batch;
+    int *keys = malloc(sizeof(int) * q);
+    bst_t **out = malloc(sizeof(bst_t *) * q), *tree = NULL;
+    size_t found = 0, check = 0;
+    int tmp;
+    clock_t t;
+
+    if (!keys || !out)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+        bst_insert(&tree, random_key());
+    /* replay the inserted keys as hits, then draw misses, then shuffle */
+    srand(98);
+    for (i = 0; i < q; i++)
+        keys[i] = random_key();
+    for (i = q - 1; i > 0; i--)
+    {
+        batch = (size_t)random_key() % (i + 1);
+        tmp = keys[i], keys[i] = keys[batch], keys[batch] = tmp;
+    }
+
+    t = clock();
+    for (i = 0; i < q; i++)
+        found += bst_search(tree, keys[i]) != NULL;
+    printf("bst_search:         %6.2f Mlookups/s (%lu found)\n",
+           q / seconds(t) / 1e6, (unsigned long)found);
+    for (batch = 1; batch <= 64; batch *= 2)
+    {
+        t = clock();
+        for (i = 0; i < q; i += batch)
+            bst_search_batch(tree, keys + i, q - i < batch ? q - i : batch,
+                             out + i);
+        printf("batch of %2lu:        %6.2f Mlookups/s\n",
+               (unsigned long)batch, q / seconds(t) / 1e6);
+    }
+    for (i = 0; i < q; i++)
+        check += out[i] != NULL && out[i]->n == keys[i];
+    free(keys);
+    free(out);
+    binary_tree_delete(tree);
+    return (check != found);
+}
@@ -0,0 +1,99 @@
+#include "binary_trees.h"
+
+/**
+ * bst_frozen_first - finds the slot of the smallest value
+ * @frozen: pointer to the frozen tree
+ * Return: index of the leftmost slot, 0 if the tree is empty
+ */
+size_t bst_frozen_first(const bst_frozen_t *frozen)
+{
+	size_t k = 1;
+
+	if (frozen->size == 0)
+		return (0);
+	while (2 * k <= frozen->size)
+		k *= 2;
+	return (k);
+}
+
+/**
+ * bst_frozen_next - finds the slot of the next value in order
+ * @frozen: pointer to the frozen tree
+ * @k: current slot
+ * Return: index of the next slot, 0 after the largest value
+ */
+size_t bst_frozen_next(const bst_frozen_t *frozen, size_t k)
+{
+	if (2 * k + 1 <= frozen->size)
+	{
+		for (k = 2 * k + 1; 2 * k <= frozen->size; k *= 2)
+			;
+		return (k);
+	}
+	while (k & 1)
+		k >>= 1;
+	return (k >> 1);
+}
+
+/**
+ * bst_freeze - compiles a BST into a contiguous Eytzinger array
+ * @tree: pointer to the root node of the BST (or AVL tree)
+ * @frozen: pointer to the frozen tree to fill
+ *
+ * The tree itself is left untouched and may be freed afterwards.
+ * Return: 1 on success, 0 on failure
+ */
+int bst_freeze(const bst_t *tree, bst_frozen_t *frozen)
+{
+	const binary_tree_t *node;
+	size_t size = 0, bytes, k;
+
+	for (node = inorder_first(tree); node; node = inorder_next(node, tree))
+		size++;
+	frozen->size = size;
+	bytes = (sizeof(int) * (size + 1) + 63) / 64 * 64;
+	frozen->keys = aligned_alloc(64, bytes);
+	if (frozen->keys == NULL)
+		return (0);
+	node = inorder_first(tree);
+	for (k = bst_frozen_first(frozen); k; k = bst_frozen_next(frozen, k))
+	{
+		frozen->keys[k] = node->n;
+		node = inorder_next(node, tree);
+	}
+	return (1);
+}
+
+/**
+ * bst_frozen_free - releases a frozen tree
+ * @frozen: pointer to the frozen tree
+ */
+void bst_frozen_free(bst_frozen_t *frozen)
+{
+	free(frozen->keys);
+	frozen->keys = NULL;
+	frozen->size = 0;
+}
+
+/**
+ * bst_thaw - turns a frozen tree back into a mutable AVL tree
+ * @frozen: pointer to the frozen tree
+ * Return: pointer to the root node of the new tree, or NULL on failure
+ */
+avl_t *bst_thaw(const bst_frozen_t *frozen)
+{
+	int *sorted;
+	size_t k, x = 0;
+	avl_t *root;
+
+	if (frozen->size == 0)
+		return (NULL);
+	sorted = malloc(sizeof(int) * frozen->size);
+	if (sorted == NULL)
+		return (NULL);
+	for (k = bst_frozen_first(frozen); k; k = bst_frozen_next(frozen, k))
+		sorted[x++] = frozen->keys[k];
+	root = sorted_array_to_avl(sorted, frozen->size);
+	free(sorted);
+	return (root);
+}
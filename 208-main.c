@@ -0,0 +1,82 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * print_num - prints a number
+ * @n: number to print
+ */
+void print_num(int n)
+{
+    printf(" %d", n);
+}
+
+/**
+ * bench - times lookups in a pointer tree and in its frozen copy
+ * @n: number of keys
+ */
+static void bench(size_t n)
+{
+    bst_t *tree = NULL;
+    bst_frozen_t frozen;
+    size_t i, a = 0, b = 0;
+    clock_t t;
+
+    srand(98);
+    for (i = 0; i < n; i++)
+        bst_insert(&tree, rand());
+    if (!bst_freeze(tree, &frozen))
+        return;
+    t = clock();
+    for (i = 0; i < 2 * n; i++)
+        a += bst_search(tree, rand()) != NULL;
+    printf("bst_search:        %.3fs\n", (double)(clock() - t) / CLOCKS_PER_SEC);
+    t = clock();
+    for (i = 0; i < 2 * n; i++)
+        b += bst_frozen_search(&frozen, rand()) != 0;
+    printf("bst_frozen_search: %.3fs\n", (double)(clock() - t) / CLOCKS_PER_SEC);
+    bst_frozen_free(&frozen);
+    binary_tree_delete(tree);
+}
+
+/**
+ * main - Entry point
+ * @ac: argument count
+ * @av: optional av[1], number of keys for a timed comparison
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    bst_t *tree;
+    bst_frozen_t frozen;
+    size_t k;
+    int array[] = {
+        79, 47, 68, 87, 84, 91, 21, 32, 34, 2,
+        20, 22, 98, 1, 62, 95
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree = array_to_bst(array, n);
+    if (!tree || !bst_freeze(tree, &frozen))
+        return (1);
+    binary_tree_delete(tree);
+    printf("Layout:");
+    for (k = 1; k <= frozen.size; k++)
+        printf(" %d", frozen.keys[k]);
+    printf("\nIn order:");
+    bst_frozen_inorder(&frozen, print_num);
+    k = bst_frozen_lower_bound(&frozen, 50);
+    printf("\nlower_bound(50): %d\n", frozen.keys[k]);
+    printf("search(34): %s, search(33): %s\n",
+           bst_frozen_search(&frozen, 34) ? "found" : "not found",
+           bst_frozen_search(&frozen, 33) ? "found" : "not found");
+    tree = bst_thaw(&frozen);
+    bst_frozen_free(&frozen);
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    if (ac > 1)
+        bench(strtoul(av[1], NULL, 10));
+    return (0);
+}
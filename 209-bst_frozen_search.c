@@ -0,0 +1,54 @@
+#include "binary_trees.h"
+
+/**
+ * bst_frozen_lower_bound - finds the first value >= a bound
+ * @frozen: pointer to the frozen tree
+ * @value: lower bound
+ *
+ * The descent is branch-free. The 16 slots four levels below the current
+ * one share a cache line, which is prefetched ahead of time while it is
+ * still inside the array.
+ * Return: slot of the value, or 0 if every value is below @value
+ */
+size_t bst_frozen_lower_bound(const bst_frozen_t *frozen, int value)
+{
+	size_t k = 1;
+
+	while (k <= frozen->size)
+	{
+		if (16 * k <= frozen->size)
+			BST_PREFETCH(frozen->keys + 16 * k);
+		k = 2 * k + (frozen->keys[k] < value);
+	}
+	while (k & 1)
+		k >>= 1;
+	return (k >> 1);
+}
+
+/**
+ * bst_frozen_search - searches a value in a frozen tree
+ * @frozen: pointer to the frozen tree
+ * @value: value to search
+ * Return: slot of the value, or 0 if it is absent
+ */
+size_t bst_frozen_search(const bst_frozen_t *frozen, int value)
+{
+	size_t k = bst_frozen_lower_bound(frozen, value);
+
+	return (k && frozen->keys[k] == value ? k : 0);
+}
+
+/**
+ * bst_frozen_inorder - goes through a frozen tree in order
+ * @frozen: pointer to the frozen tree
+ * @func: function to call with each value
+ */
+void bst_frozen_inorder(const bst_frozen_t *frozen, void (*func)(int))
+{
+	size_t k;
+
+	if (frozen == NULL || func == NULL)
+		return;
+	for (k = bst_frozen_first(frozen); k; k = bst_frozen_next(frozen, k))
+		func(frozen->keys[k]);
+}
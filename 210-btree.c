@@ -0,0 +1,112 @@
+#include "binary_trees.h"
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+/**
+ * btree_rank - counts the keys of a node that are below a value
+ * @node: pointer to the node
+ * @value: value to rank
+ *
+ * With AVX2 or SSE2 the whole key line is compared at once and the
+ * comparison mask is counted; otherwise a scalar loop does the same.
+ * Return: index of the first key >= @value, which is also the child
+ * to descend into
+ */
+int btree_rank(const btree_node_t *node, int value)
+{
+#if defined(__AVX2__)
+	__m256i v = _mm256_set1_epi32(value), lt;
+	unsigned int mask;
+
+	lt = _mm256_cmpgt_epi32(v, _mm256_load_si256((const __m256i *)node->keys));
+	mask = _mm256_movemask_ps(_mm256_castsi256_ps(lt));
+	lt = _mm256_cmpgt_epi32(v,
+			_mm256_load_si256((const __m256i *)(node->keys + 8)));
+	mask |= (unsigned int)_mm256_movemask_ps(_mm256_castsi256_ps(lt)) << 8;
+	return (__builtin_popcount(mask & ((1u << node->count) - 1)));
+#elif defined(__SSE2__)
+	__m128i v = _mm_set1_epi32(value), lt;
+	unsigned int mask = 0;
+	int x;
+
+	for (x = 0; x < 4; x++)
+	{
+		lt = _mm_cmpgt_epi32(v,
+				_mm_load_si128((const __m128i *)(node->keys + 4 * x)));
+		mask |= (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(lt)) << (4 * x);
+	}
+	return (__builtin_popcount(mask & ((1u << node->count) - 1)));
+#else
+	int x;
+
+	for (x = 0; x < node->count && node->keys[x] < value; x++)
+		;
+	return (x);
+#endif
+}
+
+/**
+ * btree_node_new - allocates an empty, cache-line aligned B-tree node
+ * @leaf: 1 for a leaf node, 0 for an internal node
+ * Return: pointer to the new node, or NULL on failure
+ */
+btree_node_t *btree_node_new(int leaf)
+{
+	size_t size = (sizeof(btree_node_t) + 63) / 64 * 64;
+	btree_node_t *node = aligned_alloc(64, size);
+
+	if (node == NULL)
+		return (NULL);
+	memset(node, 0, sizeof(btree_node_t));
+	node->leaf = leaf;
+	return (node);
+}
+
+/**
+ * btree_search - checks whether a value is in a B-tree
+ * @tree: pointer to the B-tree
+ * @value: value to search
+ * Return: 1 if the value is present, 0 otherwise
+ */
+int btree_search(const btree_t *tree, int value)
+{
+	const btree_node_t *node = tree->root;
+	int x;
+
+	while (node != NULL)
+	{
+		x = btree_rank(node, value);
+		if (x < node->count && node->keys[x] == value)
+			return (1);
+		node = node->leaf ? NULL : node->child[x];
+	}
+	return (0);
+}
+
+/**
+ * btree_free_nodes - frees a B-tree node and everything below it
+ * @node: pointer to the node
+ */
+static void btree_free_nodes(btree_node_t *node)
+{
+	int x;
+
+	if (node == NULL)
+		return;
+	if (!node->leaf)
+		for (x = 0; x <= node->count; x++)
+			btree_free_nodes(node->child[x]);
+	free(node);
+}
+
+/**
+ * btree_delete - frees every node of a B-tree and empties it
+ * @tree: pointer to the B-tree
+ */
+void btree_delete(btree_t *tree)
+{
+	btree_free_nodes(tree->root);
+	tree->root = NULL;
+	tree->size = 0;
+}
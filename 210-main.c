@@ -0,0 +1,92 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * run_btree - times insert, search and remove on the B-tree
+ * @keys: keys to use
+ * @n: number of keys
+ */
+static void run_btree(const int *keys, size_t n)
+{
+    btree_t tree = {NULL, 0};
+    size_t i, found = 0;
+    clock_t t;
+
+    t = clock();
+    for (i = 0; i < n; i++)
+        btree_insert(&tree, keys[i]);
+    printf("btree: insert %.3fs", seconds(t));
+    t = clock();
+    for (i = 0; i < n; i++)
+        found += btree_search(&tree, keys[i] ^ (int)(i & 1));
+    printf(", search %.3fs", seconds(t));
+    t = clock();
+    for (i = 0; i < n; i += 2)
+        btree_remove(&tree, keys[i]);
+    printf(", remove %.3fs (%lu found)\n", seconds(t), (unsigned long)found);
+    btree_delete(&tree);
+}
+
+/**
+ * run_binary - times insert, search and remove on a BST or an AVL tree
+ * @keys: keys to use
+ * @n: number of keys
+ * @avl: 1 for the AVL functions, 0 for the BST ones
+ */
+static void run_binary(const int *keys, size_t n, int avl)
+{
+    binary_tree_t *tree = NULL;
+    size_t i, found = 0;
+    clock_t t;
+
+    t = clock();
+    for (i = 0; i < n; i++)
+        avl ? (void)avl_insert(&tree, keys[i]) : (void)bst_insert(&tree, keys[i]);
+    printf("%s:   insert %.3fs", avl ? "avl" : "bst", seconds(t));
+    t = clock();
+    for (i = 0; i < n; i++)
+        found += bst_search(tree, keys[i] ^ (int)(i & 1)) != NULL;
+    printf(", search %.3fs", seconds(t));
+    t = clock();
+    for (i = 0; i < n; i += 2)
+        tree = avl ? avl_remove(tree, keys[i]) : bst_remove(tree, keys[i]);
+    printf(", remove %.3fs (%lu found)\n", seconds(t), (unsigned long)found);
+    binary_tree_delete(tree);
+}
+
+/**
+ * main - compares the B-tree set with bst_t and avl_t on random keys
+ * @ac: argument count
+ * @av: av[1] is the number of keys (default 1000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000, i;
+    int *keys = malloc(sizeof(int) * n);
+
+    if (!keys)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)((((unsigned int)rand() << 15) ^ rand()) & ~1u);
+    run_btree(keys, n);
+    run_binary(keys, n, 0);
+    run_binary(keys, n, 1);
+    free(keys);
+    return (0);
+}
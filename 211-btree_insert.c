@@ -0,0 +1,80 @@
+#include "binary_trees.h"
+
+/**
+ * split_child - splits the full child of a node around its median key
+ * @parent: pointer to a node that is not full
+ * @x: index of the full child
+ * Return: 1 on success, 0 on failure
+ */
+static int split_child(btree_node_t *parent, int x)
+{
+	btree_node_t *full = parent->child[x];
+	btree_node_t *half = btree_node_new(full->leaf);
+	int t = BTREE_DEGREE;
+
+	if (half == NULL)
+		return (0);
+	half->count = t - 1;
+	memcpy(half->keys, full->keys + t, sizeof(int) * (t - 1));
+	if (!full->leaf)
+		memcpy(half->child, full->child + t, sizeof(half) * t);
+	full->count = t - 1;
+	memmove(parent->child + x + 2, parent->child + x + 1,
+			sizeof(half) * (parent->count - x));
+	memmove(parent->keys + x + 1, parent->keys + x,
+			sizeof(int) * (parent->count - x));
+	parent->child[x + 1] = half;
+	parent->keys[x] = full->keys[t - 1];
+	parent->count++;
+	return (1);
+}
+
+/**
+ * btree_insert - inserts a value into a B-tree
+ * @tree: pointer to the B-tree
+ * @value: value to insert
+ *
+ * Full nodes are split on the way down, so the insertion never has to
+ * walk back up.
+ * Return: 1 if inserted, 0 if already present, -1 on failure
+ */
+int btree_insert(btree_t *tree, int value)
+{
+	btree_node_t *node, *root;
+	int x;
+
+	if (tree->root == NULL && (tree->root = btree_node_new(1)) == NULL)
+		return (-1);
+	if (btree_search(tree, value))
+		return (0);
+	if (tree->root->count == BTREE_MAX_KEYS)
+	{
+		root = btree_node_new(0);
+		if (root == NULL)
+			return (-1);
+		root->child[0] = tree->root;
+		if (!split_child(root, 0))
+		{
+			free(root);
+			return (-1);
+		}
+		tree->root = root;
+	}
+	for (node = tree->root; !node->leaf; node = node->child[x])
+	{
+		x = btree_rank(node, value);
+		if (node->child[x]->count == BTREE_MAX_KEYS)
+		{
+			if (!split_child(node, x))
+				return (-1);
+			x += value > node->keys[x];
+		}
+	}
+	x = btree_rank(node, value);
+	memmove(node->keys + x + 1, node->keys + x,
+			sizeof(int) * (node->count - x));
+	node->keys[x] = value;
+	node->count++;
+	tree->size++;
+	return (1);
+}
@@ -0,0 +1,152 @@
+#include "binary_trees.h"
+
+/**
+ * merge_children - merges child x + 1 and key x of a node into child x
+ * @parent: pointer to the node
+ * @x: index of the left child, both children hold BTREE_DEGREE - 1 keys
+ */
+static void merge_children(btree_node_t *parent, int x)
+{
+	btree_node_t *left = parent->child[x], *right = parent->child[x + 1];
+
+	left->keys[left->count] = parent->keys[x];
+	memcpy(left->keys + left->count + 1, right->keys,
+			sizeof(int) * right->count);
+	if (!left->leaf)
+		memcpy(left->child + left->count + 1, right->child,
+				sizeof(right) * (right->count + 1));
+	left->count += right->count + 1;
+	memmove(parent->keys + x, parent->keys + x + 1,
+			sizeof(int) * (parent->count - x - 1));
+	memmove(parent->child + x + 1, parent->child + x + 2,
+			sizeof(right) * (parent->count - x - 1));
+	parent->count--;
+	free(right);
+}
+
+/**
+ * borrow - moves one key into child x through the parent
+ * @parent: pointer to the node
+ * @x: index of the child that needs a key
+ * @from_left: 1 to take it from child x - 1, 0 from child x + 1
+ */
+static void borrow(btree_node_t *parent, int x, int from_left)
+{
+	btree_node_t *node = parent->child[x];
+	btree_node_t *sib = parent->child[from_left ? x - 1 : x + 1];
+
+	if (from_left)
+	{
+		memmove(node->keys + 1, node->keys, sizeof(int) * node->count);
+		memmove(node->child + 1, node->child,
+				sizeof(sib) * (node->count + 1));
+		node->keys[0] = parent->keys[x - 1];
+		node->child[0] = sib->child[sib->count];
+		parent->keys[x - 1] = sib->keys[sib->count - 1];
+	}
+	else
+	{
+		node->keys[node->count] = parent->keys[x];
+		node->child[node->count + 1] = sib->child[0];
+		parent->keys[x] = sib->keys[0];
+		memmove(sib->keys, sib->keys + 1, sizeof(int) * (sib->count - 1));
+		memmove(sib->child, sib->child + 1, sizeof(sib) * sib->count);
+	}
+	node->count++;
+	sib->count--;
+}
+
+/**
+ * fill_child - makes sure child x holds at least BTREE_DEGREE keys
+ * @parent: pointer to the node
+ * @x: index of the child about to be descended into
+ * Return: index of the child to descend into, merging may shift it
+ */
+static int fill_child(btree_node_t *parent, int x)
+{
+	if (parent->child[x]->count >= BTREE_DEGREE)
+		return (x);
+	if (x > 0 && parent->child[x - 1]->count >= BTREE_DEGREE)
+		borrow(parent, x, 1);
+	else if (x < parent->count &&
+			parent->child[x + 1]->count >= BTREE_DEGREE)
+		borrow(parent, x, 0);
+	else if (x < parent->count)
+		merge_children(parent, x);
+	else
+		merge_children(parent, --x);
+	return (x);
+}
+
+/**
+ * replace_key - replaces an internal key by its predecessor or successor
+ * @node: pointer to the internal node holding the key
+ * @x: index of the key
+ * @value: set to the value that now has to be removed below
+ *
+ * If neither neighbouring child can spare a key, both are merged around
+ * the key instead and the key itself is removed from the merged child.
+ * Return: index of the child to continue the removal in
+ */
+static int replace_key(btree_node_t *node, int x, int *value)
+{
+	btree_node_t *tmpo;
+
+	if (node->child[x]->count >= BTREE_DEGREE)
+	{
+		for (tmpo = node->child[x]; !tmpo->leaf;)
+			tmpo = tmpo->child[tmpo->count];
+		*value = node->keys[x] = tmpo->keys[tmpo->count - 1];
+		return (x);
+	}
+	if (node->child[x + 1]->count >= BTREE_DEGREE)
+	{
+		for (tmpo = node->child[x + 1]; !tmpo->leaf;)
+			tmpo = tmpo->child[0];
+		*value = node->keys[x] = tmpo->keys[0];
+		return (x + 1);
+	}
+	merge_children(node, x);
+	return (x);
+}
+
+/**
+ * btree_remove - removes a value from a B-tree
+ * @tree: pointer to the B-tree
+ * @value: value to remove
+ *
+ * Children are refilled on the way down, so every node entered below
+ * the root can lose a key and the removal is done in a single pass.
+ * Return: 1 if removed, 0 if absent
+ */
+int btree_remove(btree_t *tree, int value)
+{
+	btree_node_t *node = tree->root;
+	int x, removed = 0;
+
+	while (node != NULL)
+	{
+		x = btree_rank(node, value);
+		if (x < node->count && node->keys[x] == value && node->leaf)
+		{
+			memmove(node->keys + x, node->keys + x + 1,
+					sizeof(int) * (--node->count - x));
+			removed = 1;
+			break;
+		}
+		if (node->leaf)
+			break;
+		if (x < node->count && node->keys[x] == value)
+			node = node->child[replace_key(node, x, &value)];
+		else
+			node = node->child[fill_child(node, x)];
+	}
+	node = tree->root;
+	if (node != NULL && node->count == 0)
+	{
+		tree->root = node->leaf ? NULL : node->child[0];
+		free(node);
+	}
+	tree->size -= removed;
+	return (removed);
+}
@@ -0,0 +1,132 @@
+#include "binary_trees.h"
+
+/**
+ * stats_empty - fills the statistics of an empty tree
+ * @stats: pointer to the statistics to fill
+ */
+static void stats_empty(binary_tree_stats_t *stats)
+{
+	memset(stats, 0, sizeof(*stats));
+	stats->min = INT_MAX;
+	stats->max = INT_MIN;
+	stats->full = stats->perfect = stats->complete = 1;
+	stats->bst = stats->avl = stats->heap = 1;
+}
+
+/**
+ * binary_tree_stats_join - computes the statistics of a node from the
+ * statistics of its two subtrees
+ * @stats: pointer to the statistics to fill, may alias @left or @right
+ * @n: value stored in the node
+ * @left: statistics of the left subtree (size 0 when empty)
+ * @right: statistics of the right subtree (size 0 when empty)
+ */
+void binary_tree_stats_join(binary_tree_stats_t *stats, int n,
+		const binary_tree_stats_t *left, const binary_tree_stats_t *right)
+{
+	binary_tree_stats_t l = *left, r = *right;
+	size_t tall = l.height > r.height ? l.height : r.height;
+
+	stats->size = 1 + l.size + r.size;
+	stats->leaves = l.size + r.size == 0 ? 1 : l.leaves + r.leaves;
+	stats->internal = stats->size - stats->leaves;
+	stats->height = 1 + tall;
+	stats->min = n < l.min ? n : l.min;
+	stats->min = r.min < stats->min ? r.min : stats->min;
+	stats->max = n > r.max ? n : r.max;
+	stats->max = l.max > stats->max ? l.max : stats->max;
+	stats->sum = n + l.sum + r.sum;
+	stats->full = l.full && r.full && (l.size == 0) == (r.size == 0);
+	stats->perfect = l.perfect && r.perfect && l.height == r.height;
+	stats->complete = (l.perfect && r.complete && l.height == r.height) ||
+		(l.complete && r.perfect && l.height == r.height + 1);
+	stats->bst = l.bst && r.bst && (l.size == 0 || l.max < n) &&
+		(r.size == 0 || r.min > n);
+	stats->heap = l.heap && r.heap && stats->complete && n >= l.max &&
+		n >= r.max;
+	stats->violations = l.violations + r.violations +
+		(tall - (l.height < r.height ? l.height : r.height) > 1);
+	stats->avl = stats->bst && stats->violations == 0;
+}
+
+/**
+ * struct stats_frame_s - pending node of the post-order walk
+ * @node: node being measured
+ * @state: 0 before its left subtree, 1 during it, 2 during the right one
+ * @left: statistics of its left subtree once known
+ */
+typedef struct stats_frame_s
+{
+	const binary_tree_t *node;
+	int state;
+	binary_tree_stats_t left;
+} stats_frame_t;
+
+/**
+ * stats_push - pushes a node on a growable stack of frames
+ * @stack: pointer to the stack
+ * @top: pointer to the number of frames on the stack
+ * @cap: pointer to the capacity of the stack
+ * @node: node to push
+ * Return: 1 on success, 0 on failure
+ */
+static int stats_push(stats_frame_t **stack, size_t *top, size_t *cap,
+		const binary_tree_t *node)
+{
+	stats_frame_t *grown;
+
+	if (*top == *cap)
+	{
+		grown = realloc(*stack, sizeof(**stack) * (*cap ? *cap * 2 : 64));
+		if (grown == NULL)
+			return (0);
+		*stack = grown;
+		*cap = *cap ? *cap * 2 : 64;
+	}
+	(*stack)[*top].node = node;
+	(*stack)[*top].state = 0;
+	stats_empty(&(*stack)[(*top)++].left);
+	return (1);
+}
+
+/**
+ * binary_tree_stats - measures a binary tree in a single post-order pass
+ * @tree: pointer to the root node of the tree
+ * @stats: pointer to the statistics to fill
+ *
+ * Pending nodes live on a heap stack rather than the call stack, so depth
+ * never limits the walk, and only child links are followed, so trees
+ * built by hand with stale parent links are measured correctly too.
+ * Return: 1 on success, 0 on allocation failure
+ */
+int binary_tree_stats(const binary_tree_t *tree, binary_tree_stats_t *stats)
+{
+	stats_frame_t *stack = NULL, *f;
+	binary_tree_stats_t right;
+	size_t top = 0, cap = 0;
+	const binary_tree_t *child;
+
+	stats_empty(stats);
+	if (tree != NULL && !stats_push(&stack, &top, &cap, tree))
+		return (0);
+	while (top > 0)
+	{
+		f = &stack[top - 1];
+		child = f->state == 0 ? f->node->left : f->node->right;
+		if (f->state++ < 2)
+		{
+			if (child != NULL && !stats_push(&stack, &top, &cap, child))
+				break;
+			continue;
+		}
+		if (child == NULL)
+			stats_empty(&right);
+		else
+			right = *stats;
+		binary_tree_stats_join(stats, f->node->n, &f->left, &right);
+		if (--top > 0 && stack[top - 1].state == 1)
+			stack[top - 1].left = *stats;
+	}
+	free(stack);
+	return (top == 0);
+}
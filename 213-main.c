@@ -0,0 +1,75 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * print_stats - prints the statistics of a tree
+ * @tree: pointer to the root node of the tree
+ */
+static void print_stats(const binary_tree_t *tree)
+{
+    binary_tree_stats_t s;
+
+    if (!binary_tree_stats(tree, &s))
+        return;
+    binary_tree_print(tree);
+    printf("size %lu, leaves %lu, internal %lu, height %lu, min %d, max %d, "
+           "sum %ld\n", (unsigned long)s.size, (unsigned long)s.leaves,
+           (unsigned long)s.internal, (unsigned long)s.height, s.min, s.max,
+           s.sum);
+    printf("full %d, perfect %d, complete %d, bst %d, avl %d, "
+           "balance violations %lu\n\n", s.full, s.perfect, s.complete,
+           s.bst, s.avl, (unsigned long)s.violations);
+}
+
+/**
+ * main - Entry point
+ * @ac: argument count
+ * @av: optional av[1], size of a tree to time the validation on
+ *
+ * Return: 0 on success, error code on failure
+ */
+int main(int ac, char **av)
+{
+    binary_tree_t *root;
+    int *keys;
+    size_t n, i;
+    int avl, perfect, balance;
+    clock_t t;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    root->left->left = binary_tree_node(root->left, 6);
+    root->left->right = binary_tree_node(root->left, 56);
+    print_stats(root);
+    root->right->left = binary_tree_node(root->right, 256);
+    root->right->right = binary_tree_node(root->right, 512);
+    print_stats(root);
+    root->right->right->right = binary_tree_node(root->right->right, 600);
+    root->right->right->right->right =
+        binary_tree_node(root->right->right->right, 700);
+    print_stats(root);
+    binary_tree_delete(root);
+    if (ac < 2)
+        return (0);
+
+    n = strtoul(av[1], NULL, 10);
+    keys = malloc(sizeof(int) * n);
+    if (!keys)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i;
+    root = sorted_array_to_avl(keys, n);
+    free(keys);
+    t = clock();
+    avl = binary_tree_is_avl(root);
+    perfect = binary_tree_is_perfect(root);
+    balance = binary_tree_balance(root);
+    printf("avl %d, perfect %d, balance %d: %.3fs on %lu nodes\n", avl,
+           perfect, balance, (double)(clock() - t) / CLOCKS_PER_SEC,
+           (unsigned long)n);
+    binary_tree_delete(root);
+    return (0);
+}
@@ -0,0 +1,185 @@
+#include "binary_trees.h"
+
+/**
+ * ws_take - takes the next task of a worker, stealing when it runs dry
+ * @self: task range of the worker
+ * @i: pointer to store the task index in
+ *
+ * Return: 1 if a task was taken, 0 once every range is empty
+ */
+static int ws_take(ws_deque_t *self, size_t *i)
+{
+	ws_pool_t *pool = self->pool;
+	ws_deque_t *victim;
+	size_t k, mid, hi;
+
+	pthread_mutex_lock(&self->lock);
+	if (self->lo < self->hi)
+	{
+		*i = self->lo++;
+		pthread_mutex_unlock(&self->lock);
+		return (1);
+	}
+	pthread_mutex_unlock(&self->lock);
+	for (k = 1; k < pool->size; k++)
+	{
+		victim = &pool->deques[(self->id + k) % pool->size];
+		pthread_mutex_lock(&victim->lock);
+		if (victim->lo >= victim->hi)
+		{
+			pthread_mutex_unlock(&victim->lock);
+			continue;
+		}
+		hi = victim->hi;
+		mid = victim->lo + (hi - victim->lo) / 2;
+		victim->hi = mid;
+		pthread_mutex_unlock(&victim->lock);
+		pthread_mutex_lock(&self->lock);
+		self->lo = mid + 1;
+		self->hi = hi;
+		pthread_mutex_unlock(&self->lock);
+		*i = mid;
+		return (1);
+	}
+	return (0);
+}
+
+/**
+ * ws_worker - main loop of a worker thread
+ * @arg: task range of the worker
+ *
+ * Return: NULL
+ */
+static void *ws_worker(void *arg)
+{
+	ws_deque_t *self = arg;
+	ws_pool_t *pool = self->pool;
+	size_t seen = 0, i;
+
+	pthread_mutex_lock(&pool->lock);
+	while (1)
+	{
+		while (!pool->stop && pool->generation == seen)
+			pthread_cond_wait(&pool->work, &pool->lock);
+		if (pool->stop)
+			break;
+		seen = pool->generation;
+		pthread_mutex_unlock(&pool->lock);
+		while (ws_take(self, &i))
+			pool->fn(pool->arg, i);
+		pthread_mutex_lock(&pool->lock);
+		if (--pool->active == 0)
+			pthread_cond_signal(&pool->done);
+	}
+	pthread_mutex_unlock(&pool->lock);
+	return (NULL);
+}
+
+/**
+ * ws_pool_create - starts a pool of worker threads
+ * @size: number of workers, at least 1
+ *
+ * Return: pointer to the pool, or NULL on failure
+ */
+ws_pool_t *ws_pool_create(size_t size)
+{
+	ws_pool_t *pool;
+	size_t i;
+
+	if (size == 0)
+		return (NULL);
+	pool = calloc(1, sizeof(*pool));
+	if (pool == NULL)
+		return (NULL);
+	pool->threads = malloc(sizeof(*pool->threads) * size);
+	pool->deques = calloc(size, sizeof(*pool->deques));
+	if (pool->threads == NULL || pool->deques == NULL)
+	{
+		free(pool->threads);
+		free(pool->deques);
+		free(pool);
+		return (NULL);
+	}
+	pthread_mutex_init(&pool->lock, NULL);
+	pthread_cond_init(&pool->work, NULL);
+	pthread_cond_init(&pool->done, NULL);
+	for (i = 0; i < size; i++)
+	{
+		pool->deques[i].pool = pool;
+		pool->deques[i].id = i;
+		pthread_mutex_init(&pool->deques[i].lock, NULL);
+		if (pthread_create(&pool->threads[i], NULL, ws_worker,
+				   &pool->deques[i]) != 0)
+		{
+			pthread_mutex_destroy(&pool->deques[i].lock);
+			break;
+		}
+		pool->size++;
+	}
+	if (pool->size < size)
+	{
+		ws_pool_destroy(pool);
+		return (NULL);
+	}
+	return (pool);
+}
+
+/**
+ * ws_pool_run - runs fn(arg, i) for every i below count on the workers
+ * @pool: pointer to the pool
+ * @fn: task function, called concurrently from several threads
+ * @arg: argument passed to @fn
+ * @count: number of tasks
+ *
+ * Description: each worker starts with an even slice of the indices and
+ * steals half of another slice once its own runs out, so uneven tasks
+ * still keep every worker busy. Returns when every task has run.
+ */
+void ws_pool_run(ws_pool_t *pool, void (*fn)(void *arg, size_t i),
+		void *arg, size_t count)
+{
+	size_t i;
+
+	if (pool == NULL || count == 0)
+		return;
+	pthread_mutex_lock(&pool->lock);
+	for (i = 0; i < pool->size; i++)
+	{
+		pool->deques[i].lo = count * i / pool->size;
+		pool->deques[i].hi = count * (i + 1) / pool->size;
+	}
+	pool->fn = fn;
+	pool->arg = arg;
+	pool->active = pool->size;
+	pool->generation++;
+	pthread_cond_broadcast(&pool->work);
+	while (pool->active > 0)
+		pthread_cond_wait(&pool->done, &pool->lock);
+	pthread_mutex_unlock(&pool->lock);
+}
+
+/**
+ * ws_pool_destroy - stops the workers and frees a pool
+ * @pool: pointer to the pool
+ */
+void ws_pool_destroy(ws_pool_t *pool)
+{
+	size_t i;
+
+	if (pool == NULL)
+		return;
+	pthread_mutex_lock(&pool->lock);
+	pool->stop = 1;
+	pthread_cond_broadcast(&pool->work);
+	pthread_mutex_unlock(&pool->lock);
+	for (i = 0; i < pool->size; i++)
+		pthread_join(pool->threads[i], NULL);
+	for (i = 0; i < pool->size; i++)
+		pthread_mutex_destroy(&pool->deques[i].lock);
+	pthread_mutex_destroy(&pool->lock);
+	pthread_cond_destroy(&pool->work);
+	pthread_cond_destroy(&pool->done);
+	free(pool->threads);
+	free(pool->deques);
+	free(pool);
+}
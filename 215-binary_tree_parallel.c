@@ -0,0 +1,144 @@
+#include "binary_trees.h"
+
+/**
+ * ptree_task - reduces one task subtree
+ * @arg: pointer to the job
+ * @i: index of the task
+ *
+ * Description: statistics follow the child links only, and a subtree that
+ * could not be measured counts 1; counting and mapping use the parent-link
+ * pre-order walk, so the subtree needs consistent parent pointers for those.
+ */
+static void ptree_task(void *arg, size_t i)
+{
+	ptree_job_t *job = arg;
+	const binary_tree_t *root = job->roots[i], *node;
+	size_t count = 0;
+
+	if (job->func == NULL)
+	{
+		job->counts[i] = !binary_tree_stats(root, &job->stats[i]);
+		return;
+	}
+	binary_tree_stats(NULL, &job->stats[i]);
+	for (node = root; node != NULL; node = preorder_next(node, root))
+	{
+		if (job->map)
+			((binary_tree_t *)node)->n = job->func(node->n);
+		else
+			count += job->func(node->n) != 0;
+	}
+	job->counts[i] = count;
+}
+
+/**
+ * ptree_combine - folds the results of the tasks back in along the spine
+ * @job: pointer to the job, with every task done
+ * @stats: pointer to the statistics of the whole tree to fill
+ *
+ * Description: the spine is in post-order, so the results of spine
+ * subtrees come off a stack, the right one on top.
+ * Return: 1 on success, 0 on failure
+ */
+static int ptree_combine(ptree_job_t *job, binary_tree_stats_t *stats)
+{
+	binary_tree_stats_t *done, sub[2];
+	const ptree_spine_t *spine;
+	binary_tree_t *node;
+	size_t top = 0, i, side;
+
+	for (i = 0; i < job->size; i++)
+		job->total += job->counts[i];
+	if (job->spine_size == 0)
+	{
+		*stats = job->stats[0];
+		return (1);
+	}
+	done = malloc(sizeof(*done) * job->spine_size);
+	if (done == NULL)
+		return (0);
+	for (spine = job->spine; spine < job->spine + job->spine_size; spine++)
+	{
+		for (side = 2; side-- > 0;)
+		{
+			if (spine->sub[side] == PTREE_SPINE)
+				sub[side] = done[--top];
+			else if (spine->sub[side] == PTREE_EMPTY)
+				binary_tree_stats(NULL, &sub[side]);
+			else
+				sub[side] = job->stats[spine->sub[side]];
+		}
+		node = (binary_tree_t *)spine->node;
+		binary_tree_stats_join(&done[top++], node->n, &sub[0], &sub[1]);
+		if (job->func != NULL && job->map)
+			node->n = job->func(node->n);
+		else if (job->func != NULL)
+			job->total += job->func(node->n) != 0;
+	}
+	*stats = done[0];
+	free(done);
+	return (1);
+}
+
+/**
+ * ptree_run - runs a parallel reduction over a tree
+ * @tree: pointer to the root node of the tree
+ * @pool: pointer to the worker pool, NULL to run serially
+ * @job: pointer to the job, with func and map set by the caller
+ * @stats: pointer to the statistics to fill
+ *
+ * Description: the tree is cut by ptree_split into subtrees of at most
+ * PTREE_GRAIN nodes, which are reduced on the pool, then folded back in
+ * along the spine above them on the calling thread.
+ * Return: 1 on success, 0 on failure
+ */
+int ptree_run(const binary_tree_t *tree, ws_pool_t *pool, ptree_job_t *job,
+		binary_tree_stats_t *stats)
+{
+	size_t i;
+	int ok;
+
+	job->roots = NULL;
+	job->spine = NULL;
+	job->stats = NULL;
+	job->counts = NULL;
+	job->size = job->spine_size = job->largest = job->total = 0;
+	if (tree == NULL)
+		return (binary_tree_stats(NULL, stats));
+	ok = ptree_split(tree, job);
+	if (ok)
+	{
+		job->stats = malloc(sizeof(*job->stats) * job->size);
+		job->counts = malloc(sizeof(*job->counts) * job->size);
+	}
+	ok = ok && job->stats && job->counts;
+	if (ok && pool != NULL)
+		ws_pool_run(pool, ptree_task, job, job->size);
+	for (i = 0; ok && pool == NULL && i < job->size; i++)
+		ptree_task(job, i);
+	ok = ok && ptree_combine(job, stats);
+	ok = ok && (job->func != NULL || job->total == 0);
+	free(job->roots);
+	free(job->spine);
+	free(job->stats);
+	free(job->counts);
+	return (ok);
+}
+
+/**
+ * binary_tree_parallel_stats - measures a tree on a pool of threads
+ * @tree: pointer to the root node of the tree
+ * @pool: pointer to the worker pool, NULL to run serially
+ * @stats: pointer to the statistics to fill
+ *
+ * Return: 1 on success, 0 on failure
+ */
+int binary_tree_parallel_stats(const binary_tree_t *tree, ws_pool_t *pool,
+		binary_tree_stats_t *stats)
+{
+	ptree_job_t job;
+
+	job.func = NULL;
+	job.map = 0;
+	return (ptree_run(tree, pool, &job, stats));
+}
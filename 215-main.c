@@ -0,0 +1,139 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * wall - reads a monotonic wall clock; clock() would add up the CPU time
+ * of every worker
+ *
+ * Return: seconds since an arbitrary point
+ */
+static double wall(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * is_even - predicate for binary_tree_parallel_count_if
+ * @n: value
+ *
+ * Return: 1 if n is even, 0 otherwise
+ */
+static int is_even(int n)
+{
+    return (n % 2 == 0);
+}
+
+/**
+ * same_stats - compares the fields of two statistics
+ * @a: first statistics
+ * @b: second statistics
+ *
+ * Return: 1 if they match, 0 otherwise
+ */
+static int same_stats(const binary_tree_stats_t *a,
+                      const binary_tree_stats_t *b)
+{
+    return (a->size == b->size && a->leaves == b->leaves &&
+            a->height == b->height && a->min == b->min && a->max == b->max &&
+            a->sum == b->sum && a->bst == b->bst && a->avl == b->avl &&
+            a->complete == b->complete && a->violations == b->violations);
+}
+
+/**
+ * bench - prints the scaling curve of the parallel reductions on a tree
+ * @name: name of the tree shape
+ * @tree: pointer to the root node of the tree
+ * @threads: largest number of workers to try
+ *
+ * Return: 0 on success, 1 on failure
+ */
+static int bench(const char *name, const binary_tree_t *tree, size_t threads)
+{
+    binary_tree_stats_t serial, par;
+    ptree_job_t job;
+    ws_pool_t *pool;
+    double t, base, stats_t, count_t;
+    size_t k, evens;
+
+    t = wall();
+    if (!binary_tree_stats(tree, &serial))
+        return (1);
+    base = wall() - t;
+    job.func = NULL;
+    job.map = 0;
+    if (!ptree_run(tree, NULL, &job, &par))
+        return (1);
+    printf("%s: %lu nodes, height %lu, serial stats %.3fs\n", name,
+           (unsigned long)serial.size, (unsigned long)serial.height, base);
+    printf("%lu tasks, largest %lu nodes (%.2f%% of the tree)\n",
+           (unsigned long)job.size, (unsigned long)job.largest,
+           100.0 * job.largest / serial.size);
+    printf("%8s %10s %8s %10s %8s\n", "threads", "stats", "speedup",
+           "count_if", "evens");
+    for (k = 1; k <= threads; k *= 2)
+    {
+        pool = ws_pool_create(k);
+        if (!pool)
+            return (1);
+        t = wall();
+        if (!binary_tree_parallel_stats(tree, pool, &par) ||
+            !same_stats(&serial, &par))
+        {
+            ws_pool_destroy(pool);
+            return (1);
+        }
+        stats_t = wall() - t;
+        t = wall();
+        evens = binary_tree_parallel_count_if(tree, pool, is_even);
+        count_t = wall() - t;
+        ws_pool_destroy(pool);
+        printf("%8lu %9.3fs %7.2fx %9.3fs %8lu\n", (unsigned long)k, stats_t,
+               base / stats_t, count_t, (unsigned long)evens);
+    }
+    return (0);
+}
+
+/**
+ * main - measures the parallel reductions from 1 to 64 threads on a
+ * balanced tree, a random BST, and the same BST below a chain of 64 sorted
+ * keys, as bst_insert builds it when the keys start out in order
+ * @ac: argument count
+ * @av: av[1] tree size (default 4000000), av[2] most threads (default 64)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 4000000;
+    size_t threads = ac > 2 ? strtoul(av[2], NULL, 10) : 64, i;
+    int *keys = malloc(sizeof(int) * n);
+    bst_t *tree = NULL;
+    int ret, skewed;
+
+    if (!keys)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i;
+    tree = sorted_array_to_avl(keys, n);
+    free(keys);
+    ret = bench("balanced", tree, threads);
+    for (skewed = 0; skewed <= 1 && ret == 0; skewed++)
+    {
+        binary_tree_delete(tree);
+        tree = NULL;
+        for (i = 0; skewed && i < 64; i++)
+            bst_insert(&tree, (int)i - 64);
+        srand(98);
+        for (i = 0; i < n; i++)
+            bst_insert(&tree, (int)((((unsigned int)rand() << 15) ^ rand()) &
+                                    INT_MAX));
+        ret = bench(skewed ? "skewed" : "random", tree, threads);
+    }
+    binary_tree_delete(tree);
+    return (ret);
+}
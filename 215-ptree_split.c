@@ -0,0 +1,166 @@
+#include "binary_trees.h"
+
+/**
+ * struct ptree_frame_s - pending node of the splitting walk
+ * @node: the node
+ * @state: 0 before its left subtree, 1 before its right one, 2 after
+ * @sizes: number of nodes in its left and right subtrees
+ */
+typedef struct ptree_frame_s
+{
+	const binary_tree_t *node;
+	int state;
+	size_t sizes[2];
+} ptree_frame_t;
+
+/**
+ * ptree_grow - makes room for one more element at the end of an array
+ * @array: the array, may be NULL
+ * @cap: pointer to its capacity, in elements
+ * @size: number of elements in use
+ * @elem: size of one element
+ * Return: the array, moved if it had to grow, or NULL on failure (the
+ * array is then left as it was)
+ */
+static void *ptree_grow(void *array, size_t *cap, size_t size, size_t elem)
+{
+	if (size < *cap)
+		return (array);
+	array = realloc(array, elem * (*cap ? *cap * 2 : 64));
+	if (array != NULL)
+		*cap = *cap ? *cap * 2 : 64;
+	return (array);
+}
+
+/**
+ * ptree_push - pushes a node on the stack of the splitting walk
+ * @stack: pointer to the stack
+ * @cap: pointer to its capacity
+ * @top: pointer to the number of frames on it
+ * @node: node to push
+ * Return: 1 on success, 0 on failure
+ */
+static int ptree_push(ptree_frame_t **stack, size_t *cap, size_t *top,
+		const binary_tree_t *node)
+{
+	ptree_frame_t *grown = ptree_grow(*stack, cap, *top, sizeof(**stack));
+
+	if (grown == NULL)
+		return (0);
+	*stack = grown;
+	grown += (*top)++;
+	grown->node = node;
+	grown->state = 0;
+	grown->sizes[0] = grown->sizes[1] = 0;
+	return (1);
+}
+
+/**
+ * ptree_task_add - makes a subtree one task of the job
+ * @job: pointer to the job
+ * @root: pointer to the root node of the subtree
+ * @size: number of nodes in the subtree
+ * @cap: pointer to the capacity of job->roots
+ * Return: index of the task, or PTREE_EMPTY on failure
+ */
+static size_t ptree_task_add(ptree_job_t *job, const binary_tree_t *root,
+		size_t size, size_t *cap)
+{
+	void *grown = ptree_grow(job->roots, cap, job->size,
+			sizeof(*job->roots));
+
+	if (grown == NULL)
+		return (PTREE_EMPTY);
+	job->roots = grown;
+	if (size > job->largest)
+		job->largest = size;
+	job->roots[job->size] = root;
+	return (job->size++);
+}
+
+/**
+ * ptree_spine_add - puts a node on the spine and turns those of its
+ * children that are small enough into tasks
+ * @job: pointer to the job
+ * @f: frame of the node, with both subtrees sized
+ * @caps: capacities of job->roots and job->spine
+ * Return: 1 on success, 0 on failure
+ */
+static int ptree_spine_add(ptree_job_t *job, const ptree_frame_t *f,
+		size_t caps[2])
+{
+	const binary_tree_t *child;
+	ptree_spine_t *spine;
+	int side;
+
+	spine = ptree_grow(job->spine, &caps[1], job->spine_size,
+			sizeof(*job->spine));
+	if (spine == NULL)
+		return (0);
+	job->spine = spine;
+	spine = &job->spine[job->spine_size++];
+	spine->node = f->node;
+	for (side = 0; side < 2; side++)
+	{
+		child = side ? f->node->right : f->node->left;
+		spine->sub[side] = child == NULL ? PTREE_EMPTY : PTREE_SPINE;
+		if (child != NULL && f->sizes[side] <= PTREE_GRAIN)
+		{
+			spine->sub[side] = ptree_task_add(job, child,
+					f->sizes[side], &caps[0]);
+			if (spine->sub[side] == PTREE_EMPTY)
+				return (0);
+		}
+	}
+	return (1);
+}
+
+/**
+ * ptree_split - cuts a tree into tasks of at most PTREE_GRAIN nodes, below
+ * a spine of the nodes whose subtrees are larger
+ * @tree: pointer to the root node of the tree, not NULL
+ * @job: pointer to the job, whose roots and spine are filled
+ *
+ * Description: a post-order walk on a heap stack sizes every subtree, so
+ * depth never limits it. Where the tasks sit depends only on subtree
+ * sizes, not on depth, so a skewed tree is cut as evenly as a balanced
+ * one. With BT_ORDER_STATS the cached sizes are read instead, and only
+ * the spine is walked.
+ * Return: 1 on success, 0 on failure
+ */
+int ptree_split(const binary_tree_t *tree, ptree_job_t *job)
+{
+	ptree_frame_t *stack = NULL, *f;
+	size_t top = 0, cap = 0, caps[2] = {0, 0}, size;
+	const binary_tree_t *node = tree;
+	int ok = 1;
+
+	while (ok && (node != NULL || top > 0))
+	{
+		if (node != NULL)
+		{
+			ok = ptree_push(&stack, &cap, &top, node);
+			node = NULL;
+			continue;
+		}
+		f = &stack[top - 1];
+		if (f->state < 2)
+		{
+			node = f->state++ ? f->node->right : f->node->left;
+#ifdef BT_ORDER_STATS
+			f->sizes[f->state - 1] = node_size(node);
+			if (f->sizes[f->state - 1] <= PTREE_GRAIN)
+				node = NULL;
+#endif
+			continue;
+		}
+		size = 1 + f->sizes[0] + f->sizes[1];
+		ok = size <= PTREE_GRAIN || ptree_spine_add(job, f, caps);
+		if (--top > 0)
+			stack[top - 1].sizes[stack[top - 1].state - 1] = size;
+		else if (size <= PTREE_GRAIN)
+			ok = ptree_task_add(job, tree, size, caps) != PTREE_EMPTY;
+	}
+	free(stack);
+	return (ok);
+}
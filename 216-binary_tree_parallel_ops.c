@@ -0,0 +1,79 @@
+#include "binary_trees.h"
+
+/**
+ * binary_tree_parallel_is_bst - checks if a tree is a valid BST on a pool
+ * @tree: pointer to the root node of the tree
+ * @pool: pointer to the worker pool, NULL to run serially
+ *
+ * Return: 1 if tree is a valid BST, 0 otherwise or if tree is NULL
+ */
+int binary_tree_parallel_is_bst(const binary_tree_t *tree, ws_pool_t *pool)
+{
+	binary_tree_stats_t stats;
+
+	if (tree == NULL || !binary_tree_parallel_stats(tree, pool, &stats))
+		return (0);
+	return (stats.bst);
+}
+
+/**
+ * binary_tree_parallel_is_avl - checks if a tree is a valid AVL on a pool
+ * @tree: pointer to the root node of the tree
+ * @pool: pointer to the worker pool, NULL to run serially
+ *
+ * Return: 1 if tree is a valid AVL tree, 0 otherwise or if tree is NULL
+ */
+int binary_tree_parallel_is_avl(const binary_tree_t *tree, ws_pool_t *pool)
+{
+	binary_tree_stats_t stats;
+
+	if (tree == NULL || !binary_tree_parallel_stats(tree, pool, &stats))
+		return (0);
+	return (stats.avl);
+}
+
+/**
+ * binary_tree_parallel_count_if - counts the values matching a predicate
+ * @tree: pointer to the root node of the tree
+ * @pool: pointer to the worker pool, NULL to run serially
+ * @pred: predicate, called concurrently from several threads
+ *
+ * Return: number of values for which pred returns non-zero, 0 on failure
+ */
+size_t binary_tree_parallel_count_if(const binary_tree_t *tree,
+		ws_pool_t *pool, int (*pred)(int))
+{
+	ptree_job_t job;
+	binary_tree_stats_t stats;
+
+	if (tree == NULL || pred == NULL)
+		return (0);
+	job.func = pred;
+	job.map = 0;
+	if (!ptree_run(tree, pool, &job, &stats))
+		return (0);
+	return (job.total);
+}
+
+/**
+ * binary_tree_parallel_map - replaces every value v of a tree by func(v)
+ * @tree: pointer to the root node of the tree
+ * @pool: pointer to the worker pool, NULL to run serially
+ * @func: function to apply, called concurrently from several threads
+ *
+ * Description: the order of the calls is unspecified; a func that does
+ * not preserve the order of the values breaks the BST property.
+ * Return: 1 on success, 0 on failure
+ */
+int binary_tree_parallel_map(binary_tree_t *tree, ws_pool_t *pool,
+		int (*func)(int))
+{
+	ptree_job_t job;
+	binary_tree_stats_t stats;
+
+	if (tree == NULL || func == NULL)
+		return (0);
+	job.func = func;
+	job.map = 1;
+	return (ptree_run(tree, pool, &job, &stats));
+}
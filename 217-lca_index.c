@@ -0,0 +1,134 @@
+#include "binary_trees.h"
+
+/**
+ * lca_index_hash - computes the home slot of a node in an LCA index
+ * @index: pointer to the index
+ * @node: node to hash, only its address is used
+ *
+ * Return: slot where the probe for @node starts
+ */
+size_t lca_index_hash(const lca_index_t *index, const binary_tree_t *node)
+{
+	size_t h = ((size_t)node >> 4) * 2654435761u;
+
+	return ((h ^ (h >> 16)) & index->mask);
+}
+
+/**
+ * lca_index_slot - probes the hash of an LCA index for a node
+ * @index: pointer to the index
+ * @node: node to look for
+ *
+ * Return: pointer to the slot holding @node, or to the free slot where it
+ * would go
+ */
+lca_slot_t *lca_index_slot(const lca_index_t *index,
+		const binary_tree_t *node)
+{
+	size_t h = lca_index_hash(index, node);
+
+	while (index->slots[h].node != NULL && index->slots[h].node != node)
+		h = (h + 1) & index->mask;
+	return (&index->slots[h]);
+}
+
+/**
+ * lca_preorder - records the nodes of a tree in pre-order with their depth
+ * @index: pointer to the index, with its arrays allocated
+ * @tree: pointer to the root node of the tree
+ *
+ * Description: the walk follows the parent links, and the depth of a node
+ * is the depth of its parent, already recorded, plus one.
+ */
+static void lca_preorder(lca_index_t *index, const binary_tree_t *tree)
+{
+	const binary_tree_t *node;
+	lca_slot_t *slot;
+	size_t i = 0;
+
+	for (node = tree; node != NULL; node = preorder_next(node, tree), i++)
+	{
+		slot = lca_index_slot(index, node);
+		slot->node = node;
+		slot->index = i;
+		index->nodes[i] = node;
+		index->depth[i] = node == tree ? 0 :
+			index->depth[lca_index_find(index, node->parent)] + 1;
+	}
+}
+
+/**
+ * lca_sparse - fills the sparse table of an LCA index
+ * @index: pointer to the index, with its nodes and depths recorded
+ *
+ * Return: 1 on success, 0 on failure
+ */
+static int lca_sparse(lca_index_t *index)
+{
+	size_t k, i, half, n = index->size;
+	unsigned int *row, a, b;
+
+	for (k = 0; k < index->levels; k++)
+	{
+		row = malloc(sizeof(*row) * (n - ((size_t)1 << k) + 1));
+		if (row == NULL)
+			return (0);
+		index->table[k] = row;
+		half = ((size_t)1 << k) / 2;
+		for (i = 0; i + ((size_t)1 << k) <= n; i++)
+		{
+			if (k == 0)
+			{
+				row[i] = i;
+				continue;
+			}
+			a = index->table[k - 1][i];
+			b = index->table[k - 1][i + half];
+			row[i] = index->depth[b] < index->depth[a] ? b : a;
+		}
+	}
+	return (1);
+}
+
+/**
+ * lca_index_build - preprocesses a tree for constant-time LCA queries
+ * @index: pointer to the index to fill
+ * @tree: pointer to the root node of the tree
+ *
+ * Description: the nodes are numbered in pre-order; the lowest common
+ * ancestor of two distinct nodes is the parent of the shallowest node
+ * after the first one up to the second one, which a sparse table answers
+ * in O(1). Building takes O(n log n) time and memory. The tree needs
+ * consistent parent links, fewer than UINT_MAX nodes, and must not change
+ * while the index is in use.
+ * Return: 1 on success, 0 on failure
+ */
+int lca_index_build(lca_index_t *index, const binary_tree_t *tree)
+{
+	const binary_tree_t *node;
+	size_t n = 0, cap = 1;
+
+	memset(index, 0, sizeof(*index));
+	for (node = tree; node != NULL; node = preorder_next(node, tree))
+		n++;
+	if (n == 0 || n >= UINT_MAX)
+		return (n == 0);
+	while (cap < 2 * n)
+		cap *= 2;
+	while (((size_t)1 << index->levels) <= n)
+		index->levels++;
+	index->mask = cap - 1;
+	index->slots = calloc(cap, sizeof(*index->slots));
+	index->nodes = malloc(sizeof(*index->nodes) * n);
+	index->depth = malloc(sizeof(*index->depth) * n);
+	index->table = calloc(index->levels, sizeof(*index->table));
+	if (index->slots && index->nodes && index->depth && index->table)
+	{
+		index->size = n;
+		lca_preorder(index, tree);
+		if (lca_sparse(index))
+			return (1);
+	}
+	lca_index_free(index);
+	return (0);
+}
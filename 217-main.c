@@ -0,0 +1,148 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * ancestor_pairs - the former binary_trees_ancestor, comparing every
+ * ancestor of the first node with every ancestor of the second
+ * @first: pointer to the first node
+ * @second: pointer to the second node
+ *
+ * Return: pointer to the lowest common ancestor, or NULL
+ */
+static binary_tree_t *ancestor_pairs(const binary_tree_t *first,
+                                     const binary_tree_t *second)
+{
+    const binary_tree_t *a, *b;
+
+    for (a = first; a; a = a->parent)
+        for (b = second; b; b = b->parent)
+            if (a == b)
+                return ((binary_tree_t *)a);
+    return (NULL);
+}
+
+/**
+ * bench - times the three LCA methods on random pairs of nodes of a tree
+ * @name: name of the tree shape
+ * @tree: pointer to the root node of the tree
+ * @q: number of queries
+ *
+ * Return: 0 on success, 1 on failure
+ */
+static int bench(const char *name, const binary_tree_t *tree, size_t q)
+{
+    const binary_tree_t **nodes, **first, **second, *node;
+    binary_tree_t **out, **got;
+    lca_index_t index;
+    size_t n = 0, i, bad = 0;
+    double pairs, climb, build, batch;
+    clock_t t;
+
+    for (node = tree; node; node = preorder_next(node, tree))
+        n++;
+    nodes = malloc(sizeof(*nodes) * n);
+    first = malloc(sizeof(*first) * q);
+    second = malloc(sizeof(*second) * q);
+    out = malloc(sizeof(*out) * q);
+    got = malloc(sizeof(*got) * q);
+    if (!nodes || !first || !second || !out || !got)
+        return (1);
+    for (i = 0, node = tree; node; node = preorder_next(node, tree))
+        nodes[i++] = node;
+    for (i = 0; i < q; i++)
+    {
+        first[i] = nodes[(((size_t)rand() << 15) ^ rand()) % n];
+        second[i] = nodes[(((size_t)rand() << 15) ^ rand()) % n];
+    }
+
+    t = clock();
+    for (i = 0; i < q / 100; i++)
+        got[i] = ancestor_pairs(first[i], second[i]);
+    pairs = seconds(t) * 100;
+    t = clock();
+    for (i = 0; i < q; i++)
+        out[i] = binary_trees_ancestor(first[i], second[i]);
+    climb = seconds(t);
+    for (i = 0; i < q / 100; i++)
+        bad += got[i] != out[i];
+    t = clock();
+    if (!lca_index_build(&index, tree))
+        return (1);
+    build = seconds(t);
+    t = clock();
+    lca_index_query_batch(&index, first, second, got, q);
+    batch = seconds(t);
+    for (i = 0; i < q; i++)
+        bad += got[i] != out[i];
+    printf("%s, %lu nodes, %lu queries: pairwise %.3fs (extrapolated), "
+           "depth-aligned %.3fs, index build %.3fs + batch %.3fs, "
+           "%lu mismatches\n", name, (unsigned long)n, (unsigned long)q,
+           pairs, climb, build, batch, (unsigned long)bad);
+    lca_index_free(&index);
+    free(nodes);
+    free(first);
+    free(second);
+    free(out);
+    free(got);
+    return (bad != 0);
+}
+
+/**
+ * main - shows the LCA of a few nodes, then times the LCA methods
+ * @ac: argument count
+ * @av: av[1] tree size (default 1000000), av[2] queries (default 1000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+    size_t q = ac > 2 ? strtoul(av[2], NULL, 10) : 1000000, i;
+    binary_tree_t *root, *chain, *tail;
+    lca_index_t index;
+    bst_t *random = NULL;
+    int ret;
+
+    root = binary_tree_node(NULL, 98);
+    root->left = binary_tree_node(root, 12);
+    root->right = binary_tree_node(root, 402);
+    root->left->right = binary_tree_node(root->left, 54);
+    root->right->right = binary_tree_node(root->right, 128);
+    root->right->left = binary_tree_node(root->right, 45);
+    root->right->right->right = binary_tree_node(root->right->right, 65);
+    binary_tree_print(root);
+    if (!lca_index_build(&index, root))
+        return (1);
+    printf("Ancestor of [54] & [65]: %d\n",
+           lca_index_query(&index, root->left->right,
+                           root->right->right->right)->n);
+    printf("Ancestor of [45] & [65]: %d\n",
+           lca_index_query(&index, root->right->left,
+                           root->right->right->right)->n);
+    lca_index_free(&index);
+    binary_tree_delete(root);
+
+    srand(98);
+    for (i = 0; i < n; i++)
+        bst_insert(&random, (int)(((unsigned int)rand() << 15) ^ rand()));
+    chain = tail = binary_tree_node(NULL, 0);
+    for (i = 1; i < n / 100; i++)
+        tail = tail->right = binary_tree_node(tail, (int)i);
+    ret = bench("random", random, q) || bench("chain", chain, q / 10);
+    binary_tree_delete(random);
+    binary_tree_delete(chain);
+    return (ret);
+}
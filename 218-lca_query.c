@@ -0,0 +1,130 @@
+#include "binary_trees.h"
+
+#ifdef __GNUC__
+#define LCA_PREFETCH(ptr) __builtin_prefetch(ptr)
+#else
+#define LCA_PREFETCH(ptr) ((void)(ptr))
+#endif
+
+/* how many queries ahead lca_index_query_batch prefetches */
+#define LCA_BATCH_AHEAD 8
+
+/**
+ * lca_log2 - computes the floor of the base 2 logarithm
+ * @x: positive number
+ * Return: floor(log2(x))
+ */
+static size_t lca_log2(size_t x)
+{
+#ifdef __GNUC__
+	return (sizeof(unsigned long) * CHAR_BIT - 1 -
+		__builtin_clzl((unsigned long)x));
+#else
+	size_t k = 0;
+
+	while (x >>= 1)
+		k++;
+	return (k);
+#endif
+}
+
+/**
+ * lca_index_free - releases the memory of an LCA index
+ * @index: pointer to the index
+ */
+void lca_index_free(lca_index_t *index)
+{
+	size_t k;
+
+	if (index->table != NULL)
+	{
+		for (k = 0; k < index->levels; k++)
+			free(index->table[k]);
+	}
+	free(index->table);
+	free(index->slots);
+	free(index->nodes);
+	free(index->depth);
+	memset(index, 0, sizeof(*index));
+}
+
+/**
+ * lca_index_find - looks up the pre-order position of a node
+ * @index: pointer to the index
+ * @node: node to look for
+ *
+ * Return: position of @node, or index->size if it is not indexed
+ */
+size_t lca_index_find(const lca_index_t *index, const binary_tree_t *node)
+{
+	lca_slot_t *slot;
+
+	if (index->size == 0 || node == NULL)
+		return (index->size);
+	slot = lca_index_slot(index, node);
+	return (slot->node == NULL ? index->size : slot->index);
+}
+
+/**
+ * lca_index_query - finds the lowest common ancestor of two indexed nodes
+ * @index: pointer to the index
+ * @first: pointer to the first node
+ * @second: pointer to the second node
+ *
+ * Return: pointer to the lowest common ancestor, or NULL if either node
+ * is not in the indexed tree
+ */
+binary_tree_t *lca_index_query(const lca_index_t *index,
+		const binary_tree_t *first, const binary_tree_t *second)
+{
+	size_t a = lca_index_find(index, first);
+	size_t b = lca_index_find(index, second), k, tmp;
+	unsigned int l, r;
+
+	if (a >= index->size || b >= index->size)
+		return (NULL);
+	if (a == b)
+		return ((binary_tree_t *)index->nodes[a]);
+	if (a > b)
+	{
+		tmp = a;
+		a = b;
+		b = tmp;
+	}
+	k = lca_log2(b - a);
+	l = index->table[k][a + 1];
+	r = index->table[k][b + 1 - ((size_t)1 << k)];
+	if (index->depth[r] < index->depth[l])
+		l = r;
+	return (index->nodes[l]->parent);
+}
+
+/**
+ * lca_index_query_batch - answers many LCA queries
+ * @index: pointer to the index
+ * @first: first node of each query
+ * @second: second node of each query
+ * @out: array receiving the answer of each query
+ * @count: number of queries
+ *
+ * Description: the hash slots of the queries a few steps ahead are
+ * prefetched, since the slot lookup is the first cache miss of a query.
+ */
+void lca_index_query_batch(const lca_index_t *index,
+		const binary_tree_t **first, const binary_tree_t **second,
+		binary_tree_t **out, size_t count)
+{
+	size_t i;
+
+	for (i = 0; i < count; i++)
+	{
+		if (i + LCA_BATCH_AHEAD < count)
+		{
+			LCA_PREFETCH(index->slots +
+				lca_index_hash(index, first[i + LCA_BATCH_AHEAD]));
+			LCA_PREFETCH(index->slots +
+				lca_index_hash(index, second[i + LCA_BATCH_AHEAD]));
+		}
+		out[i] = lca_index_query(index, first[i], second[i]);
+	}
+}
@@ -0,0 +1,78 @@
+#include "binary_trees.h"
+
+/**
+ * bst_select - finds the k-th smallest value of a binary search tree
+ * @tree: pointer to the root node of the BST
+ * @k: zero-based rank of the value, 0 for the smallest
+ * Return: pointer to the node holding that value, or NULL if the tree
+ * holds k values or fewer
+ */
+bst_t *bst_select(const bst_t *tree, size_t k)
+{
+	size_t left;
+
+	while (tree != NULL)
+	{
+		left = node_size(tree->left);
+		if (k == left)
+			return ((bst_t *)tree);
+		if (k < left)
+			tree = tree->left;
+		else
+		{
+			k -= left + 1;
+			tree = tree->right;
+		}
+	}
+	return (NULL);
+}
+
+/**
+ * count_below - counts the values of a BST below a bound
+ * @tree: pointer to the root node of the BST
+ * @value: bound
+ * @inclusive: 1 to also count a value equal to the bound
+ * Return: number of values below (or at) the bound
+ */
+static size_t count_below(const bst_t *tree, int value, int inclusive)
+{
+	size_t count = 0;
+
+	while (tree != NULL)
+	{
+		if (tree->n < value || (inclusive && tree->n == value))
+		{
+			count += node_size(tree->left) + 1;
+			tree = tree->right;
+		}
+		else
+			tree = tree->left;
+	}
+	return (count);
+}
+
+/**
+ * bst_rank - counts the values of a binary search tree below a value
+ * @tree: pointer to the root node of the BST
+ * @value: value to rank, it does not need to be in the tree
+ * Return: number of values strictly smaller than value, which is the
+ * rank bst_select maps back to value when it is in the tree
+ */
+size_t bst_rank(const bst_t *tree, int value)
+{
+	return (count_below(tree, value, 0));
+}
+
+/**
+ * bst_range_count - counts the values of a binary search tree in a range
+ * @tree: pointer to the root node of the BST
+ * @lo: smallest value to count
+ * @hi: largest value to count
+ * Return: number of values v with lo <= v <= hi
+ */
+size_t bst_range_count(const bst_t *tree, int lo, int hi)
+{
+	if (lo > hi)
+		return (0);
+	return (count_below(tree, hi, 1) - count_below(tree, lo, 0));
+}
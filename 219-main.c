@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+static size_t walk_left;
+static int walk_found;
+
+/**
+ * walk_select - in-order callback counting down to the k-th value, the
+ * way k-th smallest was answered before the cached sizes
+ * @n: value of the visited node
+ */
+static void walk_select(int n)
+{
+    if (walk_left-- == 0)
+        walk_found = n;
+}
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * bench - compares bst_select with an in-order walk on a large AVL tree
+ * @n: number of values
+ * @q: number of select queries
+ *
+ * Return: 0 on success, 1 on failure
+ */
+static int bench(size_t n, size_t q)
+{
+    avl_t *tree = NULL;
+    size_t i, k, bad = 0, walks = q < 10 ? q : 10;
+    double fast, slow;
+    clock_t t;
+
+    srand(98);
+    for (i = 0; i < n; i++)
+        avl_insert(&tree, (int)(((unsigned int)rand() << 15) ^ rand()));
+    n = node_size(tree);
+    t = clock();
+    for (i = 0; i < q; i++)
+    {
+        k = (size_t)rand() % n;
+        bad += bst_rank(tree, bst_select(tree, k)->n) != k;
+    }
+    fast = seconds(t);
+    t = clock();
+    for (i = 0; i < walks; i++)
+    {
+        walk_left = k = (size_t)rand() % n;
+        binary_tree_inorder(tree, walk_select);
+        bad += bst_select(tree, k)->n != walk_found;
+    }
+    slow = seconds(t) * q / walks;
+    printf("%lu values, %lu selects: select+rank %.3fs, in-order walk "
+           "%.3fs (extrapolated), %lu mismatches\n", (unsigned long)n,
+           (unsigned long)q, fast, slow, (unsigned long)bad);
+    binary_tree_delete(tree);
+    return (bad != 0);
+}
+
+/**
+ * main - shows select, rank and range_count, then times them
+ * @ac: argument count
+ * @av: av[1] tree size (default 1000000), av[2] queries (default 1000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    avl_t *tree;
+    int array[] = {
+        98, 402, 12, 46, 128, 256, 512, 50, 1, 8, 16, 32
+    };
+    size_t n = sizeof(array) / sizeof(array[0]);
+
+    tree = array_to_avl(array, n);
+    if (!tree)
+        return (1);
+    binary_tree_print(tree);
+    printf("size %lu, 0th %d, 5th %d, 11th %d, 12th %p\n",
+           (unsigned long)node_size(tree), bst_select(tree, 0)->n,
+           bst_select(tree, 5)->n, bst_select(tree, 11)->n,
+           (void *)bst_select(tree, 12));
+    printf("rank(46) %lu, rank(47) %lu, count in [10, 100] %lu\n",
+           (unsigned long)bst_rank(tree, 46), (unsigned long)bst_rank(tree, 47),
+           (unsigned long)bst_range_count(tree, 10, 100));
+    tree = avl_remove(tree, 46);
+    tree = avl_remove(tree, 98);
+    printf("removed 46 and 98: size %lu, 5th %d, count in [10, 100] %lu\n",
+           (unsigned long)node_size(tree), bst_select(tree, 5)->n,
+           (unsigned long)bst_range_count(tree, 10, 100));
+    binary_tree_delete(tree);
+    if (ac < 2)
+        return (0);
+#ifndef BT_ORDER_STATS
+    printf("sizes are not cached, build with make ORDER_STATS=1 to time "
+           "select and rank\n");
+    return (0);
+#endif
+    return (bench(strtoul(av[1], NULL, 10),
+                  ac > 2 ? strtoul(av[2], NULL, 10) : 1000000));
+}
@@ -0,0 +1,113 @@
+#include "binary_trees.h"
+
+/**
+ * heap_array_sift_up - moves a value of an array heap up until its parent
+ * is larger
+ * @heap: pointer to the heap
+ * @i: index of the value
+ * Return: index of the value in the end
+ */
+static size_t heap_array_sift_up(heap_array_t *heap, size_t i)
+{
+	int value = heap->data[i];
+
+	while (i > 0 && heap->data[(i - 1) / 2] < value)
+	{
+		heap->data[i] = heap->data[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	heap->data[i] = value;
+	return (i);
+}
+
+/**
+ * heap_array_sift_down - moves a value of an array heap down until both
+ * of its children are smaller
+ * @heap: pointer to the heap
+ * @i: index of the value
+ * Return: index of the value in the end
+ */
+size_t heap_array_sift_down(heap_array_t *heap, size_t i)
+{
+	int value = heap->data[i];
+	size_t child;
+
+	while ((child = 2 * i + 1) < heap->size)
+	{
+		if (child + 1 < heap->size &&
+		    heap->data[child + 1] > heap->data[child])
+			child++;
+		if (heap->data[child] <= value)
+			break;
+		heap->data[i] = heap->data[child];
+		i = child;
+	}
+	heap->data[i] = value;
+	return (i);
+}
+
+/**
+ * heap_array_push - inserts a value into an array heap
+ * @heap: pointer to the heap
+ * @value: value to insert
+ * Return: 1 on success, 0 on failure
+ */
+int heap_array_push(heap_array_t *heap, int value)
+{
+	int *grown;
+	size_t cap;
+
+	if (heap == NULL)
+		return (0);
+	if (heap->size == heap->cap)
+	{
+		cap = heap->cap ? heap->cap * 2 : 64;
+		grown = realloc(heap->data, sizeof(*grown) * cap);
+		if (grown == NULL)
+			return (0);
+		heap->data = grown;
+		heap->cap = cap;
+	}
+	heap->data[heap->size++] = value;
+	heap_array_sift_up(heap, heap->size - 1);
+	return (1);
+}
+
+/**
+ * heap_array_pop - removes the largest value of an array heap
+ * @heap: pointer to the heap
+ * @value: pointer to store the value in, may be NULL
+ * Return: 1 on success, 0 if the heap is empty
+ */
+int heap_array_pop(heap_array_t *heap, int *value)
+{
+	if (heap == NULL || heap->size == 0)
+		return (0);
+	if (value != NULL)
+		*value = heap->data[0];
+	heap->data[0] = heap->data[--heap->size];
+	if (heap->size > 0)
+		heap_array_sift_down(heap, 0);
+	return (1);
+}
+
+/**
+ * heap_array_update - changes a value of an array heap
+ * @heap: pointer to the heap
+ * @i: index of the value to change
+ * @value: new value, larger or smaller than the current one
+ * Return: index of value once the heap is restored, or heap->size if i
+ * is out of range
+ */
+size_t heap_array_update(heap_array_t *heap, size_t i, int value)
+{
+	int old;
+
+	if (heap == NULL || i >= heap->size)
+		return (heap ? heap->size : 0);
+	old = heap->data[i];
+	heap->data[i] = value;
+	if (value > old)
+		return (heap_array_sift_up(heap, i));
+	return (heap_array_sift_down(heap, i));
+}
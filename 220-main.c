@@ -0,0 +1,114 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * bench_tree - times the pointer heap: n inserts then n extracts
+ * @keys: values to push
+ * @n: number of values
+ * @bad: incremented for every value popped out of order
+ *
+ * Return: elapsed seconds
+ */
+static double bench_tree(const int *keys, size_t n, size_t *bad)
+{
+    heap_t *heap = NULL;
+    clock_t t = clock();
+    size_t i;
+    int prev = INT_MAX, v;
+
+    for (i = 0; i < n; i++)
+        heap_insert(&heap, keys[i]);
+    for (i = 0; i < n; i++)
+    {
+        v = heap_extract(&heap);
+        *bad += v > prev;
+        prev = v;
+    }
+    return (seconds(t));
+}
+
+/**
+ * bench_array - times the array heap: n pushes then n pops
+ * @keys: values to push
+ * @n: number of values
+ * @bad: incremented for every value popped out of order
+ *
+ * Return: elapsed seconds
+ */
+static double bench_array(const int *keys, size_t n, size_t *bad)
+{
+    heap_array_t heap = {NULL, 0, 0};
+    clock_t t = clock();
+    size_t i;
+    int prev = INT_MAX, v;
+
+    for (i = 0; i < n; i++)
+        heap_array_push(&heap, keys[i]);
+    while (heap_array_pop(&heap, &v))
+    {
+        *bad += v > prev;
+        prev = v;
+    }
+    heap_array_free(&heap);
+    return (seconds(t));
+}
+
+/**
+ * main - compares the pointer heap with the array heap, and bottom-up
+ * heapify with one-by-one inserts
+ * @ac: argument count
+ * @av: av[1] number of values (default 1000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000, i, bad = 0;
+    int *keys = malloc(sizeof(int) * n), *sorted;
+    heap_array_t heap = {NULL, 0, 0};
+    heap_t *tree;
+    double tree_t, array_t, build_t, heapify_t, sort_t;
+    clock_t t;
+
+    if (!keys || n == 0)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)(((unsigned int)rand() << 15) ^ rand());
+    tree_t = bench_tree(keys, n, &bad);
+    array_t = bench_array(keys, n, &bad);
+    t = clock();
+    tree = array_to_heap(keys, n);
+    build_t = seconds(t);
+    bad += !binary_tree_is_heap(tree);
+    binary_tree_delete(tree);
+    t = clock();
+    heap_array_heapify(&heap, keys, n);
+    heapify_t = seconds(t);
+    t = clock();
+    sorted = heap_array_to_sorted(&heap, &i);
+    sort_t = seconds(t);
+    for (i = 1; i < n; i++)
+        bad += sorted[i] > sorted[i - 1];
+    free(sorted);
+    free(keys);
+    printf("%lu values, push+pop: pointer heap %.3fs, array heap %.3fs\n",
+           (unsigned long)n, tree_t, array_t);
+    printf("bottom-up build: pointer heap %.3fs, array heap %.3fs, "
+           "array heapsort %.3fs, %lu errors\n", build_t, heapify_t, sort_t,
+           (unsigned long)bad);
+    return (bad != 0);
+}
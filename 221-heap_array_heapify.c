@@ -0,0 +1,85 @@
+#include "binary_trees.h"
+
+/**
+ * heap_array_heapify - replaces the content of an array heap with the
+ * values of an array
+ * @heap: pointer to the heap
+ * @array: pointer to the first element of the array
+ * @size: number of elements in the array
+ *
+ * Description: the values are copied as they are, then every internal
+ * position is sifted down from the last one to the root, in O(n).
+ * Return: 1 on success, 0 on failure (the heap is left unchanged)
+ */
+int heap_array_heapify(heap_array_t *heap, const int *array, size_t size)
+{
+	int *data;
+	size_t i;
+
+	if (heap == NULL || (array == NULL && size > 0))
+		return (0);
+	if (size > heap->cap)
+	{
+		data = realloc(heap->data, sizeof(*data) * size);
+		if (data == NULL)
+			return (0);
+		heap->data = data;
+		heap->cap = size;
+	}
+	if (size > 0)
+		memcpy(heap->data, array, sizeof(*array) * size);
+	heap->size = size;
+	for (i = size / 2; i-- > 0;)
+		heap_array_sift_down(heap, i);
+	return (1);
+}
+
+/**
+ * heap_array_to_sorted - sorts the values of an array heap in place and
+ * hands them over
+ * @heap: pointer to the heap, left empty
+ * @size: address to store the number of values
+ * Return: the values in descending order, to be freed by the caller, or
+ * NULL if the heap is empty
+ */
+int *heap_array_to_sorted(heap_array_t *heap, size_t *size)
+{
+	int *data, tmp;
+	size_t n, i;
+
+	if (heap == NULL || size == NULL)
+		return (NULL);
+	n = *size = heap->size;
+	if (n == 0)
+		return (NULL);
+	while (heap->size > 1)
+	{
+		tmp = heap->data[0];
+		heap->data[0] = heap->data[--heap->size];
+		heap->data[heap->size] = tmp;
+		heap_array_sift_down(heap, 0);
+	}
+	data = heap->data;
+	for (i = 0; i < n / 2; i++)
+	{
+		tmp = data[i];
+		data[i] = data[n - 1 - i];
+		data[n - 1 - i] = tmp;
+	}
+	heap->data = NULL;
+	heap->size = heap->cap = 0;
+	return (data);
+}
+
+/**
+ * heap_array_free - releases the memory of an array heap
+ * @heap: pointer to the heap, left empty and reusable
+ */
+void heap_array_free(heap_array_t *heap)
+{
+	if (heap == NULL)
+		return;
+	free(heap->data);
+	heap->data = NULL;
+	heap->size = heap->cap = 0;
+}
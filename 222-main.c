@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * random_key - draws a pseudo-random key
+ *
+ * Return: the key
+ */
+static int random_key(void)
+{
+    return ((int)((((unsigned int)rand() << 15) ^ rand()) & 0x3fffffff));
+}
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * workload - runs the same writes and reads on an AVL or red-black tree
+ * @rb: 1 for the red-black tree, 0 for AVL
+ * @keys: n + q keys, inserted in order, each removed n steps later
+ * @n: size of the sliding window of keys kept in the tree
+ * @q: number of removals, and of lookups
+ *
+ * Return: 0 on success, 1 if the tree is invalid in the end
+ */
+static int workload(int rb, const int *keys, size_t n, size_t q)
+{
+    binary_tree_t *tree = NULL;
+    binary_tree_stats_t stats;
+    double writes, reads;
+    size_t i, hits = 0;
+    clock_t t;
+
+    t = clock();
+    for (i = 0; i < n + q; i++)
+    {
+        if (i >= n && rb)
+            tree = rb_remove(tree, keys[i - n]);
+        else if (i >= n)
+            tree = avl_remove(tree, keys[i - n]);
+        if (rb)
+            rb_insert(&tree, keys[i]);
+        else
+            avl_insert(&tree, keys[i]);
+    }
+    writes = seconds(t);
+    t = clock();
+    for (i = 0; i < q; i++)
+        hits += bst_search(tree, keys[q + (size_t)random_key() % n]) != NULL;
+    reads = seconds(t);
+    binary_tree_stats(tree, &stats);
+    printf("%-9s writes %.3fs, reads %.3fs (%lu hits), %lu nodes, "
+           "height %lu\n", rb ? "red-black" : "AVL", writes, reads,
+           (unsigned long)hits, (unsigned long)stats.size,
+           (unsigned long)stats.height);
+    i = rb ? (size_t)!binary_tree_is_rb(tree) : (size_t)!stats.avl;
+    binary_tree_delete(tree);
+    return ((int)i);
+}
+
+/**
+ * main - shows a red-black tree, then compares it with AVL on the same
+ * write and read streams
+ * @ac: argument count
+ * @av: av[1] tree size (default 1000000), av[2] removals, and lookups
+ * (default 1000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+    size_t q = ac > 2 ? strtoul(av[2], NULL, 10) : 1000000, i;
+    int array[] = {
+        98, 402, 12, 46, 128, 256, 512, 50, 1, 8, 16, 32
+    };
+    rb_t *tree = NULL;
+    int *keys, ret;
+
+    for (i = 0; i < sizeof(array) / sizeof(array[0]); i++)
+        rb_insert(&tree, array[i]);
+    binary_tree_print(tree);
+    tree = rb_remove(tree, 46);
+    tree = rb_remove(tree, 98);
+    printf("removed 46 and 98, valid %d\n", binary_tree_is_rb(tree));
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    tree = array_to_rb(array, sizeof(array) / sizeof(array[0]));
+    printf("bulk built, valid %d\n", binary_tree_is_rb(tree));
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+
+    keys = malloc(sizeof(int) * (n + q));
+    if (!keys || n == 0)
+        return (1);
+    srand(98);
+    for (i = 0; i < n + q; i++)
+        keys[i] = random_key();
+    ret = workload(0, keys, n, q) || workload(1, keys, n, q);
+    free(keys);
+    return (ret);
+}
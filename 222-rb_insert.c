@@ -0,0 +1,121 @@
+#include "binary_trees.h"
+
+/**
+ * rb_rotate - rotates a red-black subtree, keeping the colours in place
+ * @root: double pointer to the root node of the whole tree, updated when
+ * the rotation moves it
+ * @node: pointer to the root node of the subtree to rotate
+ * @left: 1 for a left rotation, 0 for a right one
+ *
+ * Description: the shared rotations refresh the cached height, which on a
+ * red-black tree is the colour, so both colours are put back afterwards;
+ * the cached sizes they refresh stay valid.
+ * Return: pointer to the new root node of the subtree
+ */
+rb_t *rb_rotate(rb_t **root, rb_t *node, int left)
+{
+	rb_t *up = left ? node->right : node->left;
+	int node_colour = node->height, up_colour = up->height;
+
+	if (left)
+		binary_tree_rotate_left(node);
+	else
+		binary_tree_rotate_right(node);
+	node->height = node_colour;
+	up->height = up_colour;
+	if (up->parent == NULL)
+		*root = up;
+	return (up);
+}
+
+/**
+ * rb_update_size - refreshes the cached size of a node and its ancestors
+ * @node: pointer to the deepest node to refresh
+ *
+ * Description: node_update_path would overwrite the colours with heights.
+ * Without BT_ORDER_STATS there is no size to refresh and nothing is done.
+ */
+void rb_update_size(rb_t *node)
+{
+#ifdef BT_ORDER_STATS
+	for (; node != NULL; node = node->parent)
+		node->size = 1 + node_size(node->left) + node_size(node->right);
+#else
+	(void)node;
+#endif
+}
+
+/**
+ * rb_insert_fixup - restores the red-black rules after an insertion
+ * @root: double pointer to the root node of the tree
+ * @node: pointer to the red node that was inserted
+ */
+static void rb_insert_fixup(rb_t **root, rb_t *node)
+{
+	rb_t *parent, *grand, *uncle;
+	int left;
+
+	while ((parent = node->parent) != NULL && parent->height == RB_RED)
+	{
+		grand = parent->parent;
+		left = parent == grand->left;
+		uncle = left ? grand->right : grand->left;
+		if (RB_COLOUR(uncle) == RB_RED)
+		{
+			parent->height = uncle->height = RB_BLACK;
+			grand->height = RB_RED;
+			node = grand;
+			continue;
+		}
+		if (node == (left ? parent->right : parent->left))
+		{
+			rb_rotate(root, parent, left);
+			node = parent;
+			parent = node->parent;
+		}
+		parent->height = RB_BLACK;
+		grand->height = RB_RED;
+		rb_rotate(root, grand, !left);
+	}
+	(*root)->height = RB_BLACK;
+}
+
+/**
+ * rb_insert - inserts a value into a red-black tree
+ * @tree: double pointer to the root node of the tree
+ * @value: value to store in the node to be inserted
+ *
+ * Description: the value is added as a red leaf, then the red-black rules
+ * are restored walking up; at most two rotations are needed, the rest is
+ * recolouring.
+ * Return: pointer to the created node, or NULL on failure or if the value
+ * is already in the tree
+ */
+rb_t *rb_insert(rb_t **tree, int value)
+{
+	rb_t *parent = NULL, *cur, *node;
+
+	if (tree == NULL)
+		return (NULL);
+	cur = *tree;
+	while (cur != NULL)
+	{
+		if (cur->n == value)
+			return (NULL);
+		parent = cur;
+		cur = value < cur->n ? cur->left : cur->right;
+	}
+	node = binary_tree_node(parent, value);
+	if (node == NULL)
+		return (NULL);
+	node->height = RB_RED;
+	if (parent == NULL)
+		*tree = node;
+	else if (value < parent->n)
+		parent->left = node;
+	else
+		parent->right = node;
+	rb_update_size(parent);
+	rb_insert_fixup(tree, node);
+	return (node);
+}
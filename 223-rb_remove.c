@@ -0,0 +1,133 @@
+#include "binary_trees.h"
+
+/**
+ * rb_transplant - puts a subtree in the place of another one
+ * @root: double pointer to the root node of the tree
+ * @old: pointer to the subtree to replace
+ * @sub: pointer to the replacement, may be NULL
+ */
+static void rb_transplant(rb_t **root, rb_t *old, rb_t *sub)
+{
+	if (old->parent == NULL)
+		*root = sub;
+	else if (old == old->parent->left)
+		old->parent->left = sub;
+	else
+		old->parent->right = sub;
+	if (sub != NULL)
+		sub->parent = old->parent;
+}
+
+/**
+ * rb_unlink - takes a node out of a red-black tree
+ * @root: double pointer to the root node of the tree
+ * @node: pointer to the node to take out
+ * @x: pointer to store the node that took the place of the removed one
+ * @xp: pointer to store the parent of *x, needed when *x is NULL
+ *
+ * Description: a node with two children is replaced by its in-order
+ * successor, which takes over its colour, so the node actually removed
+ * from its position is the successor.
+ * Return: colour of the node removed from its position
+ */
+static int rb_unlink(rb_t **root, rb_t *node, rb_t **x, rb_t **xp)
+{
+	rb_t *succ;
+	int colour = node->height;
+
+	if (node->left == NULL || node->right == NULL)
+	{
+		*x = node->left != NULL ? node->left : node->right;
+		*xp = node->parent;
+		rb_transplant(root, node, *x);
+		return (colour);
+	}
+	for (succ = node->right; succ->left != NULL; succ = succ->left)
+		;
+	colour = succ->height;
+	*x = succ->right;
+	*xp = succ;
+	if (succ->parent != node)
+	{
+		*xp = succ->parent;
+		rb_transplant(root, succ, succ->right);
+		succ->right = node->right;
+		succ->right->parent = succ;
+	}
+	rb_transplant(root, node, succ);
+	succ->left = node->left;
+	succ->left->parent = succ;
+	succ->height = node->height;
+	return (colour);
+}
+
+/**
+ * rb_remove_fixup - restores the red-black rules after a black node was
+ * removed
+ * @root: double pointer to the root node of the tree
+ * @x: pointer to the node carrying the missing black, may be NULL
+ * @xp: pointer to the parent of @x
+ */
+static void rb_remove_fixup(rb_t **root, rb_t *x, rb_t *xp)
+{
+	rb_t *w;
+	int left;
+
+	while (x != *root && RB_COLOUR(x) == RB_BLACK)
+	{
+		left = x == xp->left;
+		w = left ? xp->right : xp->left;
+		if (w->height == RB_RED)
+		{
+			w->height = RB_BLACK;
+			xp->height = RB_RED;
+			rb_rotate(root, xp, left);
+			w = left ? xp->right : xp->left;
+		}
+		if (RB_COLOUR(w->left) == RB_BLACK &&
+		    RB_COLOUR(w->right) == RB_BLACK)
+		{
+			w->height = RB_RED;
+			x = xp;
+			xp = x->parent;
+			continue;
+		}
+		if (RB_COLOUR(left ? w->right : w->left) == RB_BLACK)
+		{
+			(left ? w->left : w->right)->height = RB_BLACK;
+			w->height = RB_RED;
+			w = rb_rotate(root, w, !left);
+		}
+		w->height = xp->height;
+		xp->height = RB_BLACK;
+		(left ? w->right : w->left)->height = RB_BLACK;
+		rb_rotate(root, xp, left);
+		x = *root;
+	}
+	if (x != NULL)
+		x->height = RB_BLACK;
+}
+
+/**
+ * rb_remove - removes a value from a red-black tree
+ * @root: pointer to the root node of the tree
+ * @value: value to remove
+ *
+ * Description: at most three rotations are needed, the rest is
+ * recolouring, where AVL may rotate at every level on the way up.
+ * Return: pointer to the new root node of the tree
+ */
+rb_t *rb_remove(rb_t *root, int value)
+{
+	rb_t *node = bst_search(root, value), *x, *xp;
+	int colour;
+
+	if (node == NULL)
+		return (root);
+	colour = rb_unlink(&root, node, &x, &xp);
+	rb_update_size(xp);
+	tree_node_free(node);
+	if (colour == RB_BLACK)
+		rb_remove_fixup(&root, x, xp);
+	return (root);
+}
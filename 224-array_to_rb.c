@@ -0,0 +1,44 @@
+#include "binary_trees.h"
+
+/**
+ * rb_paint - colours a balanced tree built from a sorted array
+ * @node: pointer to the current node
+ * @depth: depth of @node
+ * @deepest: depth of the deepest level
+ *
+ * Description: the deepest level is red unless it is the root, every
+ * other level is black. Every path from the root to a missing child then
+ * crosses the same number of black nodes, since the builder leaves those
+ * missing children on the last two levels only.
+ */
+static void rb_paint(rb_t *node, size_t depth, size_t deepest)
+{
+	if (node == NULL)
+		return;
+	node->height = depth == deepest && depth > 0 ? RB_RED : RB_BLACK;
+	rb_paint(node->left, depth + 1, deepest);
+	rb_paint(node->right, depth + 1, deepest);
+}
+
+/**
+ * array_to_rb - builds a red-black tree from an array
+ * @array: pointer to the first element of the array, sorted in place
+ * @size: number of elements in the array
+ *
+ * Description: like array_to_avl, the sorted values are laid out as a
+ * balanced tree in O(n), then coloured, instead of being inserted one by
+ * one. Duplicate values are dropped.
+ * Return: pointer to the root node of the created tree, or NULL on failure
+ */
+rb_t *array_to_rb(int *array, size_t size)
+{
+	rb_t *root;
+
+	if (array == NULL || size == 0)
+		return (NULL);
+	qsort(array, size, sizeof(int), comp_int);
+	root = sorted_array_to_bst(array, size);
+	if (root != NULL)
+		rb_paint(root, 0, (size_t)root->height - 1);
+	return (root);
+}
@@ -0,0 +1,48 @@
+#include "binary_trees.h"
+
+/* no valid red-black tree of 64-bit sized nodes is deeper than this */
+#define RB_MAX_DEPTH 128
+
+/**
+ * rb_black_height - checks the colours of a red-black subtree
+ * @node: pointer to the root node of the subtree
+ * @depth: depth of @node, the walk gives up past RB_MAX_DEPTH
+ * Return: number of black nodes on every path down to a missing child,
+ * or -1 if those differ or a red node has a red child
+ */
+static int rb_black_height(const rb_t *node, size_t depth)
+{
+	int left, right;
+
+	if (node == NULL)
+		return (1);
+	if (depth > RB_MAX_DEPTH ||
+	    (node->height != RB_RED && node->height != RB_BLACK))
+		return (-1);
+	if (node->height == RB_RED && (RB_COLOUR(node->left) == RB_RED ||
+				       RB_COLOUR(node->right) == RB_RED))
+		return (-1);
+	left = rb_black_height(node->left, depth + 1);
+	right = rb_black_height(node->right, depth + 1);
+	if (left < 0 || left != right)
+		return (-1);
+	return (left + (node->height == RB_BLACK));
+}
+
+/**
+ * binary_tree_is_rb - checks if a binary tree is a valid red-black tree
+ * @tree: pointer to the root node of the tree to check
+ * Return: 1 if tree is a valid BST with a black root, no red node with a
+ * red child and the same number of black nodes on every downward path,
+ * 0 otherwise or if tree is NULL
+ */
+int binary_tree_is_rb(const binary_tree_t *tree)
+{
+	binary_tree_stats_t stats;
+
+	if (tree == NULL || tree->height != RB_BLACK)
+		return (0);
+	if (!binary_tree_stats(tree, &stats) || !stats.bst)
+		return (0);
+	return (rb_black_height(tree, 0) > 0);
+}
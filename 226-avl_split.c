@@ -0,0 +1,48 @@
+#include "binary_trees.h"
+
+/**
+ * avl_split - splits an AVL tree around a value
+ * @tree: pointer to the root node of the tree, consumed
+ * @value: value to split around
+ * @left: pointer to store the tree of the values below value
+ * @right: pointer to store the tree of the values above value
+ *
+ * Description: every node on the search path is rejoined with the side it
+ * belongs to; the joins on one side have increasing heights, so the whole
+ * split costs O(log n).
+ * Return: the detached node holding value, or NULL if value is not in
+ * the tree
+ */
+avl_t *avl_split(avl_t *tree, int value, avl_t **left, avl_t **right)
+{
+	avl_t *sub_l = NULL, *sub_r = NULL, *found;
+
+	if (tree == NULL)
+	{
+		*left = *right = NULL;
+		return (NULL);
+	}
+	sub_l = tree->left;
+	sub_r = tree->right;
+	if (sub_l != NULL)
+		sub_l->parent = NULL;
+	if (sub_r != NULL)
+		sub_r->parent = NULL;
+	tree->left = tree->right = tree->parent = NULL;
+	if (value == tree->n)
+	{
+		*left = sub_l;
+		*right = sub_r;
+		node_update(tree);
+		return (tree);
+	}
+	if (value < tree->n)
+	{
+		found = avl_split(sub_l, value, left, &sub_l);
+		*right = avl_join(sub_l, tree, sub_r);
+		return (found);
+	}
+	found = avl_split(sub_r, value, &sub_r, right);
+	*left = avl_join(sub_l, tree, sub_r);
+	return (found);
+}
@@ -0,0 +1,135 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+static avl_t *merge_into;
+
+/**
+ * insert_into - in-order callback inserting every value into merge_into,
+ * the way two sets were merged before avl_union
+ * @n: value of the visited node
+ */
+static void insert_into(int n)
+{
+    avl_insert(&merge_into, n);
+}
+
+/**
+ * wall - reads a monotonic wall clock
+ *
+ * Return: seconds since an arbitrary point
+ */
+static double wall(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * random_set - builds an AVL tree of random multiples of a step
+ * @size: number of values drawn
+ * @step: every value is a multiple of step
+ *
+ * Return: pointer to the root node of the tree
+ */
+static avl_t *random_set(size_t size, int step)
+{
+    int *keys = malloc(sizeof(int) * size);
+    avl_t *tree;
+    size_t i;
+
+    if (!keys)
+        return (NULL);
+    for (i = 0; i < size; i++)
+        keys[i] = (int)((((unsigned int)rand() << 15) ^ rand()) % 100000000)
+                  * step;
+    tree = array_to_avl(keys, size);
+    free(keys);
+    return (tree);
+}
+
+/**
+ * bench - times merging an m-value set into an n-value set
+ * @n: size of the large set
+ * @m: size of the small set
+ * @threads: threads for the parallel run
+ *
+ * Return: 0 on success, 1 if the results disagree
+ */
+static int bench(size_t n, size_t m, size_t threads)
+{
+    avl_t *a, *b;
+    double t, naive, serial, par;
+    size_t sizes[3];
+
+    srand(98);
+    merge_into = random_set(n, 2);
+    b = random_set(m, 3);
+    t = wall();
+    binary_tree_inorder(b, insert_into);
+    naive = wall() - t;
+    sizes[0] = node_size(merge_into);
+    binary_tree_delete(merge_into);
+    binary_tree_delete(b);
+
+    srand(98);
+    a = random_set(n, 2);
+    b = random_set(m, 3);
+    t = wall();
+    a = avl_union(a, b, 1);
+    serial = wall() - t;
+    sizes[1] = node_size(a);
+    binary_tree_delete(a);
+
+    srand(98);
+    a = random_set(n, 2);
+    b = random_set(m, 3);
+    t = wall();
+    a = avl_union(a, b, threads);
+    par = wall() - t;
+    sizes[2] = binary_tree_is_avl(a) ? node_size(a) : 0;
+    binary_tree_delete(a);
+    printf("%8lu into %8lu: insert loop %.3fs, union %.3fs, "
+           "union on %lu threads %.3fs, result %lu\n", (unsigned long)m,
+           (unsigned long)n, naive, serial, (unsigned long)threads, par,
+           (unsigned long)sizes[2]);
+    return (sizes[0] != sizes[1] || sizes[1] != sizes[2]);
+}
+
+/**
+ * main - shows the set operations, then compares avl_union with inserting
+ * one value at a time
+ * @ac: argument count
+ * @av: av[1] size of the large set (default 1000000), av[2] threads
+ * (default 4)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+    size_t threads = ac > 2 ? strtoul(av[2], NULL, 10) : 4;
+    int evens[] = {0, 2, 4, 6, 8, 10, 12, 14}, thirds[] = {0, 3, 6, 9, 12};
+    avl_t *tree;
+
+    tree = avl_union(sorted_array_to_avl(evens, 8),
+                     sorted_array_to_avl(thirds, 5), 1);
+    printf("union:\n");
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    tree = avl_intersection(sorted_array_to_avl(evens, 8),
+                            sorted_array_to_avl(thirds, 5), 1);
+    printf("intersection:\n");
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    tree = avl_difference(sorted_array_to_avl(evens, 8),
+                          sorted_array_to_avl(thirds, 5), 1);
+    printf("difference:\n");
+    binary_tree_print(tree);
+    binary_tree_delete(tree);
+    return (bench(n, n / 1000, threads) || bench(n, n / 10, threads) ||
+            bench(n, n, threads));
+}
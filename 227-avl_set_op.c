@@ -0,0 +1,106 @@
+#include "binary_trees.h"
+
+/*
+ * below this height a subtree pair is not worth a thread; the cached
+ * heights are used as sizes are only cached with BT_ORDER_STATS, and an
+ * AVL tree this tall holds between 609 and 8191 nodes
+ */
+#define AVL_SETOP_GRAIN 13
+
+/**
+ * setop_edge - finishes a set operation when one of the trees is empty
+ * @a: pointer to the root node of the first tree
+ * @b: pointer to the root node of the second tree
+ * @op: AVL_UNION, AVL_INTERSECTION or AVL_DIFFERENCE
+ * Return: pointer to the root node of the result
+ */
+static avl_t *setop_edge(avl_t *a, avl_t *b, int op)
+{
+	if (op == AVL_UNION)
+		return (a != NULL ? a : b);
+	binary_tree_delete(b);
+	if (op == AVL_DIFFERENCE)
+		return (a);
+	binary_tree_delete(a);
+	return (NULL);
+}
+
+/**
+ * setop_combine - rejoins the two halves of a set operation
+ * @a: detached node of the first tree the halves were split around
+ * @found: detached node of the second tree with the same value, or NULL
+ * @left: result on the values below a->n
+ * @right: result on the values above a->n
+ * @op: AVL_UNION, AVL_INTERSECTION or AVL_DIFFERENCE
+ * Return: pointer to the root node of the result
+ */
+static avl_t *setop_combine(avl_t *a, avl_t *found, avl_t *left,
+		avl_t *right, int op)
+{
+	int keep = op == AVL_UNION ||
+		(op == AVL_INTERSECTION) == (found != NULL);
+
+	if (found != NULL)
+		tree_node_free(found);
+	if (keep)
+		return (avl_join(left, a, right));
+	tree_node_free(a);
+	return (avl_join2(left, right));
+}
+
+/**
+ * setop_thread - runs one half of a set operation on its own thread
+ * @arg: pointer to the avl_setop_t describing the half
+ * Return: NULL
+ */
+static void *setop_thread(void *arg)
+{
+	avl_setop_t *job = arg;
+
+	job->result = avl_set_op(job->a, job->b, job->op, job->forks);
+	return (NULL);
+}
+
+/**
+ * avl_set_op - combines two AVL trees into one
+ * @a: pointer to the root node of the first tree, consumed
+ * @b: pointer to the root node of the second tree, consumed
+ * @op: AVL_UNION, AVL_INTERSECTION or AVL_DIFFERENCE (a minus b)
+ * @forks: number of extra threads the operation may start
+ *
+ * Description: b is split around the root of a, the operation recurses on
+ * both halves, then the halves are joined back with or without the root.
+ * With m the size of the smaller tree this is O(m log(n / m + 1)). While
+ * forks remain, the left half runs on a new thread; nodes dropped from
+ * the result are freed from that thread. Pools are not thread-safe, so
+ * no thread is started when the caller has one selected.
+ * Return: pointer to the root node of the result
+ */
+avl_t *avl_set_op(avl_t *a, avl_t *b, int op, size_t forks)
+{
+	avl_t *found, *right, *b_right;
+	avl_setop_t job;
+	pthread_t thread;
+	int spawned = 0;
+
+	if (a == NULL || b == NULL)
+		return (setop_edge(a, b, op));
+	spawned = forks > 0 && tree_alloc_get() == NULL &&
+		(node_height(a) >= AVL_SETOP_GRAIN ||
+		node_height(b) >= AVL_SETOP_GRAIN);
+	found = avl_split(b, a->n, &job.b, &b_right);
+	job.a = a->left;
+	right = a->right;
+	a->left = a->right = a->parent = NULL;
+	job.op = op;
+	job.forks = spawned ? (forks - 1) / 2 : 0;
+	if (spawned)
+		spawned = pthread_create(&thread, NULL, setop_thread, &job) == 0;
+	if (!spawned)
+		setop_thread(&job);
+	right = avl_set_op(right, b_right, op,
+			spawned ? forks - 1 - job.forks : 0);
+	if (spawned)
+		pthread_join(thread, NULL);
+	return (setop_combine(a, found, job.result, right, op));
+}
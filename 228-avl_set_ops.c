@@ -0,0 +1,42 @@
+#include "binary_trees.h"
+
+/**
+ * avl_union - merges two AVL trees
+ * @a: pointer to the root node of the first tree, consumed
+ * @b: pointer to the root node of the second tree, consumed
+ * @threads: number of threads to use, 0 or 1 to stay on the caller's
+ * Return: pointer to the root node of the tree holding the values of
+ * both trees, each once
+ */
+avl_t *avl_union(avl_t *a, avl_t *b, size_t threads)
+{
+	return (avl_set_op(a, b, AVL_UNION, threads > 1 ? threads - 1 : 0));
+}
+
+/**
+ * avl_intersection - keeps the values two AVL trees have in common
+ * @a: pointer to the root node of the first tree, consumed
+ * @b: pointer to the root node of the second tree, consumed
+ * @threads: number of threads to use, 0 or 1 to stay on the caller's
+ * Return: pointer to the root node of the tree holding the values found
+ * in both trees
+ */
+avl_t *avl_intersection(avl_t *a, avl_t *b, size_t threads)
+{
+	return (avl_set_op(a, b, AVL_INTERSECTION,
+			   threads > 1 ? threads - 1 : 0));
+}
+
+/**
+ * avl_difference - removes the values of an AVL tree from another one
+ * @a: pointer to the root node of the tree to remove values from, consumed
+ * @b: pointer to the root node of the values to remove, consumed
+ * @threads: number of threads to use, 0 or 1 to stay on the caller's
+ * Return: pointer to the root node of the tree holding the values of a
+ * that are not in b
+ */
+avl_t *avl_difference(avl_t *a, avl_t *b, size_t threads)
+{
+	return (avl_set_op(a, b, AVL_DIFFERENCE,
+			   threads > 1 ? threads - 1 : 0));
+}
@@ -0,0 +1,224 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * struct bench_s - state shared by the writer and the readers
+ * @cell: current persistent version
+ * @lock: lock around tree for the mutable AVL run
+ * @tree: mutable AVL tree
+ * @keys: n + q keys, inserted in order, each removed n steps later
+ * @n: size of the sliding window of keys kept in the tree
+ * @q: number of removals
+ * @done: set by the writer once it is finished
+ * @lookups: total lookups made by the readers
+ * @persistent: 1 for the persistent run, 0 for the mutable one
+ */
+typedef struct bench_s
+{
+    pavl_cell_t cell;
+    pthread_mutex_t lock;
+    avl_t *tree;
+    const int *keys;
+    size_t n;
+    size_t q;
+    atomic_int done;
+    atomic_size_t lookups;
+    int persistent;
+} bench_t;
+
+/**
+ * wall - reads a monotonic wall clock
+ *
+ * Return: seconds since an arbitrary point
+ */
+static double wall(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * reader - looks up window keys in batches of 64 until the writer is done
+ * @arg: pointer to the bench_t
+ *
+ * Return: NULL
+ */
+static void *reader(void *arg)
+{
+    bench_t *b = arg;
+    pavl_node_t *snap;
+    size_t i, count = 0, seed = (size_t)&snap;
+
+    while (!atomic_load(&b->done))
+    {
+        snap = b->persistent ? pavl_cell_snapshot(&b->cell) : NULL;
+        if (!b->persistent)
+            pthread_mutex_lock(&b->lock);
+        for (i = 0; i < 64; i++, count++)
+        {
+            seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+            if (b->persistent)
+                pavl_search(snap, b->keys[(seed >> 33) % (b->n + b->q)]);
+            else
+                bst_search(b->tree, b->keys[(seed >> 33) % (b->n + b->q)]);
+        }
+        if (b->persistent)
+            pavl_release(snap);
+        else
+            pthread_mutex_unlock(&b->lock);
+    }
+    atomic_fetch_add(&b->lookups, count);
+    return (NULL);
+}
+
+/**
+ * write_step - replaces the oldest window key by the next one
+ * @b: pointer to the bench_t
+ * @i: index of the key to insert
+ */
+static void write_step(bench_t *b, size_t i)
+{
+    pavl_node_t *cur, *next;
+
+    if (!b->persistent)
+    {
+        pthread_mutex_lock(&b->lock);
+        if (i >= b->n)
+            b->tree = avl_remove(b->tree, b->keys[i - b->n]);
+        avl_insert(&b->tree, b->keys[i]);
+        pthread_mutex_unlock(&b->lock);
+        return;
+    }
+    cur = pavl_cell_snapshot(&b->cell);
+    next = i >= b->n ? pavl_remove(cur, b->keys[i - b->n]) : pavl_retain(cur);
+    pavl_release(cur);
+    cur = pavl_insert(next, b->keys[i]);
+    pavl_release(next);
+    pavl_cell_publish(&b->cell, cur);
+}
+
+/**
+ * run - times q sliding-window updates while readers look keys up
+ * @b: pointer to the bench_t
+ * @readers: number of reader threads
+ *
+ * Return: 0 on success, 1 on failure
+ */
+static int run(bench_t *b, size_t readers)
+{
+    pthread_t threads[64];
+    size_t i, size;
+    double t;
+
+    for (i = 0; i < b->n; i++)
+        write_step(b, i);
+    atomic_store(&b->done, 0);
+    atomic_store(&b->lookups, 0);
+    for (i = 0; i < readers; i++)
+        pthread_create(&threads[i], NULL, reader, b);
+    t = wall();
+    for (i = b->n; i < b->n + b->q; i++)
+        write_step(b, i);
+    t = wall() - t;
+    atomic_store(&b->done, 1);
+    for (i = 0; i < readers; i++)
+        pthread_join(threads[i], NULL);
+    size = b->persistent ? PAVL_SIZE(b->cell.root) : node_size(b->tree);
+    printf("%-10s %lu updates %.3fs, %lu lookups by %lu readers "
+           "(%.0f/s), %lu nodes\n", b->persistent ? "persistent" : "locked",
+           (unsigned long)b->q, t, (unsigned long)atomic_load(&b->lookups),
+           (unsigned long)readers, atomic_load(&b->lookups) / t,
+           (unsigned long)size);
+    return (b->persistent && pavl_live() != size);
+}
+
+/**
+ * versions - measures the memory kept alive by old versions
+ * @keys: n + k keys
+ * @n: size of the first version
+ * @k: number of versions kept on top of it, one insertion each
+ */
+static void versions(const int *keys, size_t n, size_t k)
+{
+    pavl_node_t **kept = malloc(sizeof(*kept) * (k + 1));
+    size_t i, base;
+
+    if (!kept)
+        return;
+    kept[0] = NULL;
+    for (i = 0; i < n; i++)
+    {
+        kept[1] = pavl_insert(kept[0], keys[i]);
+        pavl_release(kept[0]);
+        kept[0] = kept[1];
+    }
+    base = pavl_live();
+    for (i = 1; i <= k; i++)
+        kept[i] = pavl_insert(kept[i - 1], keys[n + i - 1]);
+    printf("%lu versions kept on %lu nodes: %lu extra nodes, %.1f per "
+           "version\n", (unsigned long)k, (unsigned long)n,
+           (unsigned long)(pavl_live() - base),
+           (double)(pavl_live() - base) / k);
+    for (i = 0; i <= k; i++)
+        pavl_release(kept[i]);
+    free(kept);
+}
+
+/**
+ * main - shows versions of a persistent AVL tree, then compares lock-free
+ * readers on snapshots with readers of a mutable tree under a lock
+ * @ac: argument count
+ * @av: av[1] tree size (default 1000000), av[2] updates (default 200000),
+ * av[3] readers (default 4)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+    size_t q = ac > 2 ? strtoul(av[2], NULL, 10) : 200000;
+    size_t readers = ac > 3 ? strtoul(av[3], NULL, 10) : 4, i;
+    int array[] = {98, 402, 12, 46, 128, 256, 512, 50, 1, 8, 16, 32};
+    pavl_node_t *v1 = NULL, *v2;
+    bench_t b = {0};
+    int *keys, ret;
+
+    for (i = 0; i < sizeof(array) / sizeof(array[0]); i++)
+    {
+        v2 = pavl_insert(v1, array[i]);
+        pavl_release(v1);
+        v1 = v2;
+    }
+    v2 = pavl_remove(v1, 46);
+    printf("v1: %lu nodes, has 46: %d; v2: %lu nodes, has 46: %d; "
+           "%lu nodes live\n", (unsigned long)PAVL_SIZE(v1),
+           pavl_search(v1, 46) != NULL, (unsigned long)PAVL_SIZE(v2),
+           pavl_search(v2, 46) != NULL, (unsigned long)pavl_live());
+    pavl_release(v1);
+    pavl_release(v2);
+
+    keys = malloc(sizeof(int) * (n + q));
+    if (!keys || n == 0 || readers > 64)
+        return (1);
+    srand(98);
+    for (i = 0; i < n + q; i++)
+        keys[i] = (int)((((unsigned int)rand() << 15) ^ rand()) & 0x3fffffff);
+    versions(keys, n, q < 1000 ? q : 1000);
+    pavl_cell_init(&b.cell);
+    pthread_mutex_init(&b.lock, NULL);
+    b.keys = keys;
+    b.n = n;
+    b.q = q;
+    ret = run(&b, readers);
+    b.persistent = 1;
+    ret |= run(&b, readers);
+    pavl_cell_destroy(&b.cell);
+    binary_tree_delete(b.tree);
+    pthread_mutex_destroy(&b.lock);
+    free(keys);
+    return (ret || pavl_live() != 0);
+}
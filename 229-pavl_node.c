@@ -0,0 +1,92 @@
+#include "binary_trees.h"
+
+static atomic_size_t pavl_nodes;
+
+/**
+ * pavl_live - counts the persistent AVL nodes currently allocated
+ *
+ * Description: nodes are shared between versions, so this is the memory
+ * all live versions take together; the difference before and after
+ * keeping a version is what that version costs.
+ * Return: number of allocated nodes
+ */
+size_t pavl_live(void)
+{
+	return (atomic_load(&pavl_nodes));
+}
+
+/**
+ * pavl_node_new - creates a persistent AVL leaf
+ * @value: value to put in the new node
+ * Return: pointer to the new node, with one reference, or NULL on failure
+ */
+pavl_node_t *pavl_node_new(int value)
+{
+	pavl_node_t *node = malloc(sizeof(pavl_node_t));
+
+	if (node == NULL)
+		return (NULL);
+	node->n = value;
+	node->height = 1;
+	node->size = 1;
+	atomic_init(&node->refs, 1);
+	node->left = node->right = NULL;
+	atomic_fetch_add(&pavl_nodes, 1);
+	return (node);
+}
+
+/**
+ * pavl_copy - copies a persistent AVL node, sharing its children
+ * @node: pointer to the node to copy
+ * Return: pointer to the copy, with one reference, or NULL on failure
+ */
+pavl_node_t *pavl_copy(const pavl_node_t *node)
+{
+	pavl_node_t *copy = pavl_node_new(node->n);
+
+	if (copy == NULL)
+		return (NULL);
+	copy->height = node->height;
+	copy->size = node->size;
+	copy->left = pavl_retain(node->left);
+	copy->right = pavl_retain(node->right);
+	return (copy);
+}
+
+/**
+ * pavl_retain - takes a reference on a persistent AVL subtree
+ * @node: pointer to the root node of the subtree, may be NULL
+ *
+ * Description: retaining the root of a version is how a snapshot of it is
+ * taken; it is O(1) whatever the size of the tree.
+ * Return: node
+ */
+pavl_node_t *pavl_retain(pavl_node_t *node)
+{
+	if (node != NULL)
+		atomic_fetch_add_explicit(&node->refs, 1, memory_order_relaxed);
+	return (node);
+}
+
+/**
+ * pavl_release - drops a reference on a persistent AVL subtree
+ * @node: pointer to the root node of the subtree, may be NULL
+ *
+ * Description: a node whose last reference goes is freed and drops its
+ * references on its children in turn, so only the nodes no other version
+ * shares are reclaimed. Recursion follows the tree, O(log n) deep.
+ */
+void pavl_release(pavl_node_t *node)
+{
+	pavl_node_t *left, *right;
+
+	if (node == NULL ||
+	    atomic_fetch_sub_explicit(&node->refs, 1, memory_order_acq_rel) != 1)
+		return;
+	left = node->left;
+	right = node->right;
+	free(node);
+	atomic_fetch_sub(&pavl_nodes, 1);
+	pavl_release(left);
+	pavl_release(right);
+}
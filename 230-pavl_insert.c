@@ -0,0 +1,138 @@
+#include "binary_trees.h"
+
+/**
+ * pavl_own - makes sure a child slot of a private node is private too
+ * @slot: pointer to the child slot of a node only the caller can reach
+ *
+ * Description: a node with a single reference hanging from a private node
+ * is reachable from nowhere else and may be changed in place; a shared one
+ * is replaced by a copy first.
+ * Return: pointer to the private child, or NULL on failure
+ */
+static pavl_node_t *pavl_own(pavl_node_t **slot)
+{
+	pavl_node_t *copy;
+
+	if (atomic_load(&(*slot)->refs) == 1)
+		return (*slot);
+	copy = pavl_copy(*slot);
+	if (copy == NULL)
+		return (NULL);
+	pavl_release(*slot);
+	*slot = copy;
+	return (copy);
+}
+
+/**
+ * pavl_update - recomputes the height and size of a private node
+ * @node: pointer to the node
+ */
+static void pavl_update(pavl_node_t *node)
+{
+	int l = PAVL_HEIGHT(node->left), r = PAVL_HEIGHT(node->right);
+
+	node->height = (l > r ? l : r) + 1;
+	node->size = PAVL_SIZE(node->left) + PAVL_SIZE(node->right) + 1;
+}
+
+/**
+ * pavl_rotate - rotates a private node with one of its children
+ * @node: pointer to the node, which goes down
+ * @right: 1 to rotate right (the left child goes up), 0 to rotate left
+ * Return: pointer to the new subtree root, or NULL on failure
+ */
+static pavl_node_t *pavl_rotate(pavl_node_t *node, int right)
+{
+	pavl_node_t *pivot = pavl_own(right ? &node->left : &node->right);
+
+	if (pivot == NULL)
+		return (NULL);
+	if (right)
+	{
+		node->left = pivot->right;
+		pivot->right = node;
+	}
+	else
+	{
+		node->right = pivot->left;
+		pivot->left = node;
+	}
+	pavl_update(node);
+	pavl_update(pivot);
+	return (pivot);
+}
+
+/**
+ * pavl_rebalance - restores the AVL balance of a private node
+ * @node: pointer to the node, whose children are balanced and differ in
+ * height by at most 2
+ *
+ * Description: the node and the children it rotates must be reachable
+ * from the caller only; shared children are copied before they move.
+ * Return: pointer to the balanced subtree root, or NULL on failure, in
+ * which case node is released
+ */
+pavl_node_t *pavl_rebalance(pavl_node_t *node)
+{
+	int bal = PAVL_HEIGHT(node->left) - PAVL_HEIGHT(node->right);
+	pavl_node_t *child, *root = node;
+
+	pavl_update(node);
+	if (bal > 1 || bal < -1)
+	{
+		child = bal > 1 ? node->left : node->right;
+		if (bal > 1 ? PAVL_HEIGHT(child->left) < PAVL_HEIGHT(child->right)
+		    : PAVL_HEIGHT(child->right) < PAVL_HEIGHT(child->left))
+		{
+			child = pavl_own(bal > 1 ? &node->left : &node->right);
+			child = child ? pavl_rotate(child, bal < -1) : NULL;
+			if (child != NULL && bal > 1)
+				node->left = child;
+			else if (child != NULL)
+				node->right = child;
+		}
+		root = child ? pavl_rotate(node, bal > 1) : NULL;
+	}
+	if (root == NULL)
+		pavl_release(node);
+	return (root);
+}
+
+/**
+ * pavl_insert - inserts a value in a persistent AVL tree
+ * @root: pointer to the root node of the version to insert in, kept
+ * @value: value to insert
+ *
+ * Description: only the O(log n) nodes on the search path are copied;
+ * every other subtree is shared with root, which stays valid and
+ * unchanged for whoever holds it.
+ * Return: pointer to the root node of the new version, with one
+ * reference, or NULL on failure. If value is already present, the new
+ * version is root itself with one more reference.
+ */
+pavl_node_t *pavl_insert(pavl_node_t *root, int value)
+{
+	pavl_node_t *copy, *sub, **slot, *child;
+
+	if (root == NULL)
+		return (pavl_node_new(value));
+	if (value == root->n)
+		return (pavl_retain(root));
+	child = value < root->n ? root->left : root->right;
+	sub = pavl_insert(child, value);
+	if (sub == NULL || sub == child)
+	{
+		pavl_release(sub);
+		return (sub != NULL ? pavl_retain(root) : NULL);
+	}
+	copy = pavl_copy(root);
+	if (copy == NULL)
+	{
+		pavl_release(sub);
+		return (NULL);
+	}
+	slot = value < root->n ? &copy->left : &copy->right;
+	pavl_release(*slot);
+	*slot = sub;
+	return (pavl_rebalance(copy));
+}
@@ -0,0 +1,87 @@
+#include "binary_trees.h"
+
+/**
+ * pavl_unlink - builds the version of a subtree without its root
+ * @root: pointer to the root node of the subtree, kept
+ * Return: pointer to the root node of the new subtree, with one reference,
+ * or NULL if it is empty or on failure
+ */
+static pavl_node_t *pavl_unlink(pavl_node_t *root)
+{
+	const pavl_node_t *next;
+	pavl_node_t *copy, *sub;
+
+	if (root->left == NULL || root->right == NULL)
+		return (pavl_retain(root->left ? root->left : root->right));
+	for (next = root->right; next->left != NULL; next = next->left)
+		;
+	sub = pavl_remove(root->right, next->n);
+	copy = sub || root->right->size == 1 ? pavl_copy(root) : NULL;
+	if (copy == NULL)
+	{
+		pavl_release(sub);
+		return (NULL);
+	}
+	copy->n = next->n;
+	pavl_release(copy->right);
+	copy->right = sub;
+	return (pavl_rebalance(copy));
+}
+
+/**
+ * pavl_remove - removes a value from a persistent AVL tree
+ * @root: pointer to the root node of the version to remove from, kept
+ * @value: value to remove
+ *
+ * Description: like pavl_insert, only the search path (and the path to
+ * the in-order successor) is copied, plus at most one sibling per level
+ * that a rotation moves; root stays valid and unchanged.
+ * Return: pointer to the root node of the new version, with one
+ * reference, or NULL if it is empty or on failure (failure is when root
+ * had more than the one node removed). If value is not present, the new
+ * version is root itself with one more reference.
+ */
+pavl_node_t *pavl_remove(pavl_node_t *root, int value)
+{
+	pavl_node_t *copy, *sub, *child, **slot;
+
+	if (root == NULL)
+		return (NULL);
+	if (value == root->n)
+		return (pavl_unlink(root));
+	child = value < root->n ? root->left : root->right;
+	if (child == NULL)
+		return (pavl_retain(root));
+	sub = pavl_remove(child, value);
+	if (sub == child || (sub == NULL && child->size > 1))
+	{
+		pavl_release(sub);
+		return (sub != NULL ? pavl_retain(root) : NULL);
+	}
+	copy = pavl_copy(root);
+	if (copy == NULL)
+	{
+		pavl_release(sub);
+		return (NULL);
+	}
+	slot = value < root->n ? &copy->left : &copy->right;
+	pavl_release(*slot);
+	*slot = sub;
+	return (pavl_rebalance(copy));
+}
+
+/**
+ * pavl_search - looks a value up in a persistent AVL tree
+ * @root: pointer to the root node of the version to search
+ * @value: value to look for
+ *
+ * Description: versions never change, so a reader holding a reference on
+ * root needs no lock, whatever writers do meanwhile.
+ * Return: pointer to the node holding value, or NULL if it is absent
+ */
+const pavl_node_t *pavl_search(const pavl_node_t *root, int value)
+{
+	while (root != NULL && root->n != value)
+		root = value < root->n ? root->left : root->right;
+	return (root);
+}
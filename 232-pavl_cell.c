@@ -0,0 +1,63 @@
+#include "binary_trees.h"
+
+/**
+ * pavl_cell_init - initializes an empty shared version slot
+ * @cell: pointer to the slot
+ */
+void pavl_cell_init(pavl_cell_t *cell)
+{
+	pthread_mutex_init(&cell->lock, NULL);
+	cell->root = NULL;
+}
+
+/**
+ * pavl_cell_snapshot - takes a snapshot of the current version
+ * @cell: pointer to the slot
+ *
+ * Description: O(1); the lock only covers reading the root and taking a
+ * reference, so a writer cannot free the version in between. The snapshot
+ * is then read without any lock until pavl_release.
+ * Return: pointer to the root node of the version, with one reference
+ */
+pavl_node_t *pavl_cell_snapshot(pavl_cell_t *cell)
+{
+	pavl_node_t *root;
+
+	pthread_mutex_lock(&cell->lock);
+	root = pavl_retain(cell->root);
+	pthread_mutex_unlock(&cell->lock);
+	return (root);
+}
+
+/**
+ * pavl_cell_publish - makes a version the current one
+ * @cell: pointer to the slot
+ * @root: pointer to the root node of the new version, whose reference is
+ * handed to the slot
+ *
+ * Description: the previous version is released once it is swapped out;
+ * the nodes it shares with the new one or with snapshots stay alive.
+ * Writers building on the current version must take turns, e.g. under a
+ * lock of their own: the slot only orders publications.
+ */
+void pavl_cell_publish(pavl_cell_t *cell, pavl_node_t *root)
+{
+	pavl_node_t *old;
+
+	pthread_mutex_lock(&cell->lock);
+	old = cell->root;
+	cell->root = root;
+	pthread_mutex_unlock(&cell->lock);
+	pavl_release(old);
+}
+
+/**
+ * pavl_cell_destroy - releases the current version and the slot
+ * @cell: pointer to the slot
+ */
+void pavl_cell_destroy(pavl_cell_t *cell)
+{
+	pavl_release(cell->root);
+	cell->root = NULL;
+	pthread_mutex_destroy(&cell->lock);
+}
@@ -0,0 +1,103 @@
+#include "binary_trees.h"
+
+/* a thread tries to free its retired nodes every this many retirements */
+#define CBST_LIMBO 64
+
+/**
+ * cbst_node_new - creates a node of a concurrent BST
+ * @value: value to put in the new node
+ * Return: pointer to the new node, or NULL on failure
+ */
+cbst_node_t *cbst_node_new(int value)
+{
+	cbst_node_t *node = malloc(sizeof(cbst_node_t));
+
+	if (node == NULL)
+		return (NULL);
+	node->n = value;
+	atomic_init(&node->deleted, 0);
+	node->unlinked = 0;
+	pthread_mutex_init(&node->lock, NULL);
+	atomic_init(&node->left, NULL);
+	atomic_init(&node->right, NULL);
+	node->limbo = NULL;
+	node->epoch = 0;
+	return (node);
+}
+
+/**
+ * cbst_enter - announces that a thread starts reading the tree
+ * @tree: pointer to the tree
+ * @self: slot of the calling thread
+ *
+ * Description: until cbst_leave, no node the thread may still reach is
+ * freed, whoever unlinks it.
+ */
+void cbst_enter(cbst_t *tree, cbst_thread_t *self)
+{
+	atomic_store(&self->epoch, atomic_load(&tree->epoch) << 1 | 1);
+	atomic_thread_fence(memory_order_seq_cst);
+}
+
+/**
+ * cbst_leave - announces that a thread holds no node of the tree anymore
+ * @self: slot of the calling thread
+ */
+void cbst_leave(cbst_thread_t *self)
+{
+	atomic_store_explicit(&self->epoch, 0, memory_order_release);
+}
+
+/**
+ * cbst_advance - moves the global epoch on if every thread inside an
+ * operation has seen it
+ * @tree: pointer to the tree
+ */
+static void cbst_advance(cbst_t *tree)
+{
+	unsigned long epoch = atomic_load(&tree->epoch), seen;
+	size_t i;
+
+	for (i = 0; i < CBST_MAX_THREADS; i++)
+	{
+		seen = atomic_load(&tree->threads[i].epoch);
+		if ((seen & 1) && seen >> 1 != epoch)
+			return;
+	}
+	atomic_compare_exchange_strong(&tree->epoch, &epoch, epoch + 1);
+}
+
+/**
+ * cbst_retire - hands an unlinked node over for reclamation
+ * @tree: pointer to the tree
+ * @self: slot of the calling thread
+ * @node: pointer to the node, no longer reachable from the tree
+ *
+ * Description: a node retired in epoch e is freed once the global epoch
+ * reaches e + 2: by then every thread that could have read a link to it
+ * has left the operation it read it in.
+ */
+void cbst_retire(cbst_t *tree, cbst_thread_t *self, cbst_node_t *node)
+{
+	cbst_node_t **link, *dead;
+	unsigned long epoch;
+
+	node->epoch = atomic_load(&tree->epoch);
+	node->limbo = self->limbo;
+	self->limbo = node;
+	if (++self->retired % CBST_LIMBO != 0)
+		return;
+	cbst_advance(tree);
+	epoch = atomic_load(&tree->epoch);
+	for (link = &self->limbo; *link != NULL; link = &(*link)->limbo)
+		if ((*link)->epoch + 2 <= epoch)
+			break;
+	while (*link != NULL)
+	{
+		dead = *link;
+		*link = dead->limbo;
+		pthread_mutex_destroy(&dead->lock);
+		free(dead);
+		self->retired--;
+	}
+}
@@ -0,0 +1,201 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * struct worker_s - one thread of the benchmark
+ * @tree: concurrent tree, or NULL to use the shared bst_t under a mutex
+ * @id: index of the thread; it owns the keys equal to id modulo threads
+ * @threads: number of threads
+ * @range: keys are drawn in [0, range)
+ * @ops: number of operations to run
+ * @reads: percentage of the operations that are lookups
+ * @model: what the thread expects in the tree for each of its keys
+ */
+typedef struct worker_s
+{
+    cbst_t *tree;
+    size_t id;
+    size_t threads;
+    size_t range;
+    size_t ops;
+    size_t reads;
+    char *model;
+} worker_t;
+
+static bst_t *locked_tree;
+static pthread_mutex_t tree_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * wall - reads a monotonic wall clock
+ *
+ * Return: seconds since an arbitrary point
+ */
+static double wall(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * apply - runs one operation on the tree of a worker
+ * @w: pointer to the worker
+ * @self: slot of the thread in the concurrent tree
+ * @op: 0 to look up, 1 to insert, 2 to remove
+ * @key: key of the operation
+ *
+ * Return: 1 if the key is in the tree after a lookup, or if an insertion
+ * or removal changed the tree; 0 otherwise
+ */
+static int apply(worker_t *w, cbst_thread_t *self, int op, int key)
+{
+    int ret;
+
+    if (w->tree != NULL && op == 0)
+        return (cbst_search(w->tree, self, key));
+    if (w->tree != NULL)
+        return (op == 1 ? cbst_insert(w->tree, self, key) == 1
+                : cbst_remove(w->tree, self, key));
+    pthread_mutex_lock(&tree_lock);
+    if (op == 0)
+        ret = bst_search(locked_tree, key) != NULL;
+    else if (op == 1)
+        ret = bst_insert(&locked_tree, key) != NULL;
+    else
+    {
+        ret = bst_search(locked_tree, key) != NULL;
+        locked_tree = bst_remove(locked_tree, key);
+    }
+    pthread_mutex_unlock(&tree_lock);
+    return (ret);
+}
+
+/**
+ * work - runs the operations of a worker and checks every answer against
+ * its model; no other thread touches its keys
+ * @arg: pointer to the worker_t
+ *
+ * Return: NULL on success, arg if an answer was wrong
+ */
+static void *work(void *arg)
+{
+    worker_t *w = arg;
+    cbst_thread_t *self = w->tree ? cbst_register(w->tree) : NULL;
+    size_t i, seed = w->id * 2654435761UL + w->ops, slot;
+    int op, bad = 0;
+
+    for (i = 0; i < w->ops; i++)
+    {
+        seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+        slot = (seed >> 33) % (w->range / w->threads);
+        op = (seed >> 16) % 100 < w->reads ? 0 : 1 + (int)(seed >> 8) % 2;
+        if (apply(w, self, op, (int)(slot * w->threads + w->id)) !=
+            (op == 0 ? w->model[slot] : (op == 1) != w->model[slot]))
+            bad = 1;
+        if (op != 0)
+            w->model[slot] = op == 1;
+    }
+    if (self)
+        cbst_unregister(self);
+    return (bad ? arg : NULL);
+}
+
+/**
+ * run - times a mix of operations on a tree shared by several threads
+ * @tree: concurrent tree, or NULL for the mutex-protected bst_t
+ * @threads: number of threads
+ * @range: key range; a warm-up fills about a third of it
+ * @ops: operations per thread
+ * @reads: percentage of lookups
+ *
+ * Return: throughput in millions of operations per second, or -1 if an
+ * answer was wrong
+ */
+static double run(cbst_t *tree, size_t threads, size_t range, size_t ops,
+                  size_t reads)
+{
+    pthread_t ids[64];
+    worker_t w[64];
+    size_t i;
+    double t;
+    void *bad = NULL, *ret;
+
+    for (i = 0; i < threads; i++)
+    {
+        w[i].tree = tree;
+        w[i].id = i;
+        w[i].threads = threads;
+        w[i].range = range;
+        w[i].ops = range / threads;
+        w[i].reads = 0;
+        w[i].model = calloc(range / threads, 1);
+        if (!w[i].model || work(&w[i]))
+            return (-1);
+        w[i].ops = ops;
+        w[i].reads = reads;
+    }
+    t = wall();
+    for (i = 0; i < threads; i++)
+        pthread_create(&ids[i], NULL, work, &w[i]);
+    for (i = 0; i < threads; i++)
+    {
+        pthread_join(ids[i], &ret);
+        bad = ret ? ret : bad;
+        free(w[i].model);
+    }
+    t = wall() - t;
+    return (bad ? -1 : threads * ops / t / 1e6);
+}
+
+/**
+ * main - checks and times a concurrent BST against one mutex around the
+ * bst_t API, for several read ratios, then checks that removing the keys
+ * still in the tree leaves no routing node behind
+ * @ac: argument count
+ * @av: av[1] key range (default 1000000), av[2] operations per thread
+ * (default 500000), av[3] largest number of threads (default 8)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t range = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+    size_t ops = ac > 2 ? strtoul(av[2], NULL, 10) : 500000;
+    size_t max = ac > 3 ? strtoul(av[3], NULL, 10) : 8, k, r;
+    size_t ratios[] = {100, 90, 50, 0};
+    double locked, conc;
+    cbst_thread_t *self;
+    cbst_t *tree;
+    size_t key;
+
+    if (max == 0 || max > 64)
+        return (1);
+    printf("%8s %6s %12s %12s\n", "threads", "reads", "mutex Mop/s",
+           "cbst Mop/s");
+    for (r = 0; r < sizeof(ratios) / sizeof(ratios[0]); r++)
+        for (k = 1; k <= max; k *= 2)
+        {
+            locked = run(NULL, k, range, ops, ratios[r]);
+            binary_tree_delete(locked_tree);
+            locked_tree = NULL;
+            tree = cbst_create();
+            conc = tree ? run(tree, k, range, ops, ratios[r]) : -1;
+            self = conc >= 0 ? cbst_register(tree) : NULL;
+            for (key = 0; self != NULL && key < range; key++)
+                if (cbst_search(tree, self, (int)key))
+                    cbst_remove(tree, self, (int)key);
+            if (self == NULL || atomic_load(&tree->head.right) != NULL)
+                conc = -1;
+            if (self != NULL)
+                cbst_unregister(self);
+            cbst_destroy(tree);
+            printf("%8lu %5lu%% %12.2f %12.2f\n", (unsigned long)k,
+                   (unsigned long)ratios[r], locked, conc);
+            if (locked < 0 || conc < 0)
+                return (1);
+        }
+    return (0);
+}
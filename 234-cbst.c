@@ -0,0 +1,101 @@
+#include "binary_trees.h"
+
+/**
+ * cbst_free - frees the nodes of a concurrent BST subtree
+ * @node: pointer to the root node of the subtree
+ */
+static void cbst_free(cbst_node_t *node)
+{
+	if (node == NULL)
+		return;
+	cbst_free(atomic_load(&node->left));
+	cbst_free(atomic_load(&node->right));
+	pthread_mutex_destroy(&node->lock);
+	free(node);
+}
+
+/**
+ * cbst_create - creates an empty concurrent binary search tree
+ * Return: pointer to the tree, or NULL on failure
+ */
+cbst_t *cbst_create(void)
+{
+	cbst_t *tree = aligned_alloc(_Alignof(cbst_t), sizeof(cbst_t));
+	size_t i;
+
+	if (tree == NULL)
+		return (NULL);
+	tree->head.n = 0;
+	atomic_init(&tree->head.deleted, 1);
+	tree->head.unlinked = 0;
+	pthread_mutex_init(&tree->head.lock, NULL);
+	atomic_init(&tree->head.left, NULL);
+	atomic_init(&tree->head.right, NULL);
+	atomic_init(&tree->epoch, 0);
+	for (i = 0; i < CBST_MAX_THREADS; i++)
+	{
+		atomic_init(&tree->threads[i].epoch, 0);
+		atomic_init(&tree->threads[i].used, 0);
+		tree->threads[i].limbo = NULL;
+		tree->threads[i].retired = 0;
+	}
+	return (tree);
+}
+
+/**
+ * cbst_destroy - frees a concurrent BST, once no thread uses it anymore
+ * @tree: pointer to the tree
+ */
+void cbst_destroy(cbst_t *tree)
+{
+	cbst_node_t *node;
+	size_t i;
+
+	if (tree == NULL)
+		return;
+	cbst_free(atomic_load(&tree->head.right));
+	for (i = 0; i < CBST_MAX_THREADS; i++)
+	{
+		while (tree->threads[i].limbo != NULL)
+		{
+			node = tree->threads[i].limbo;
+			tree->threads[i].limbo = node->limbo;
+			pthread_mutex_destroy(&node->lock);
+			free(node);
+		}
+	}
+	pthread_mutex_destroy(&tree->head.lock);
+	free(tree);
+}
+
+/**
+ * cbst_register - gives the calling thread a slot to operate on a tree
+ * @tree: pointer to the tree
+ *
+ * Description: a slot is used by one thread at a time; the nodes it still
+ * has to free pass on to the next thread taking it.
+ * Return: pointer to the slot, or NULL if CBST_MAX_THREADS are taken
+ */
+cbst_thread_t *cbst_register(cbst_t *tree)
+{
+	size_t i;
+	int unused;
+
+	for (i = 0; i < CBST_MAX_THREADS; i++)
+	{
+		unused = 0;
+		if (atomic_compare_exchange_strong(&tree->threads[i].used, &unused,
+						   1))
+			return (&tree->threads[i]);
+	}
+	return (NULL);
+}
+
+/**
+ * cbst_unregister - gives a slot back
+ * @self: slot of the calling thread, outside of any operation
+ */
+void cbst_unregister(cbst_thread_t *self)
+{
+	atomic_store(&self->used, 0);
+}
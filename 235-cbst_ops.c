@@ -0,0 +1,183 @@
+#include "binary_trees.h"
+
+/* child link of parent on the side of value; the head only has a right */
+#define CBST_SLOT(tree, parent, value) \
+	((parent) == &(tree)->head || (value) > (parent)->n ? \
+	 &(parent)->right : &(parent)->left)
+
+/**
+ * cbst_locate - walks down a concurrent BST without taking any lock
+ * @tree: pointer to the tree
+ * @value: value to look for
+ * @parent: pointer to store the last node visited before the result
+ *
+ * Description: writers only add leaves and splice out nodes with at most
+ * one child, so a node never changes key range: a walk reading links
+ * while they change still ends where value is, or would be.
+ * Return: pointer to the node holding value, or NULL if there is none
+ */
+static cbst_node_t *cbst_locate(cbst_t *tree, int value,
+		cbst_node_t **parent)
+{
+	cbst_node_t *prev = &tree->head, *node = atomic_load(&tree->head.right);
+
+	while (node != NULL && node->n != value)
+	{
+		prev = node;
+		node = atomic_load(value < node->n ? &node->left : &node->right);
+	}
+	*parent = prev;
+	return (node);
+}
+
+/**
+ * cbst_search - checks whether a concurrent BST holds a value
+ * @tree: pointer to the tree
+ * @self: slot of the calling thread
+ * @value: value to look for
+ *
+ * Description: takes no lock and never waits for writers.
+ * Return: 1 if value is in the tree, 0 otherwise
+ */
+int cbst_search(cbst_t *tree, cbst_thread_t *self, int value)
+{
+	cbst_node_t *node, *parent;
+	int found;
+
+	cbst_enter(tree, self);
+	node = cbst_locate(tree, value, &parent);
+	found = node != NULL && !atomic_load(&node->deleted);
+	cbst_leave(self);
+	return (found);
+}
+
+/**
+ * cbst_insert - inserts a value in a concurrent BST
+ * @tree: pointer to the tree
+ * @self: slot of the calling thread
+ * @value: value to insert
+ *
+ * Description: the walk takes no lock; only the node that gets the new
+ * leaf, or the removed node holding value, is locked and checked to be
+ * still in the tree before it changes. Otherwise the walk starts over.
+ * Return: 1 if value was inserted, 0 if it was already present, -1 on
+ * allocation failure
+ */
+int cbst_insert(cbst_t *tree, cbst_thread_t *self, int value)
+{
+	cbst_node_t *node, *parent, *leaf = NULL;
+	int ret = -1;
+
+	cbst_enter(tree, self);
+	while (ret < 0)
+	{
+		node = cbst_locate(tree, value, &parent);
+		if (node == NULL && leaf == NULL)
+			leaf = cbst_node_new(value);
+		if (node == NULL && leaf == NULL)
+			break;
+		parent = node != NULL ? node : parent;
+		pthread_mutex_lock(&parent->lock);
+		if (node != NULL && !node->unlinked)
+			ret = atomic_exchange(&node->deleted, 0);
+		else if (node == NULL && !parent->unlinked &&
+			 atomic_load(CBST_SLOT(tree, parent, value)) == NULL)
+		{
+			atomic_store(CBST_SLOT(tree, parent, value), leaf);
+			leaf = NULL;
+			ret = 1;
+		}
+		pthread_mutex_unlock(&parent->lock);
+	}
+	cbst_leave(self);
+	if (leaf != NULL)
+	{
+		pthread_mutex_destroy(&leaf->lock);
+		free(leaf);
+	}
+	return (ret);
+}
+
+/**
+ * cbst_unlink - removes a node from a concurrent BST, both locks held
+ * @tree: pointer to the tree
+ * @self: slot of the calling thread
+ * @parent: pointer to the parent node, locked
+ * @node: pointer to the node to remove, locked
+ * @prune: 1 to only splice out node if it is already marked deleted
+ *
+ * Description: a node with two children is only marked deleted and keeps
+ * routing searches; one with at most one child is spliced out and
+ * retired, even if it was already marked.
+ * Return: 1 if the value was removed, 0 if it already was (or, when
+ * pruning, if it is not marked), -1 if the nodes moved since they were
+ * found
+ */
+static int cbst_unlink(cbst_t *tree, cbst_thread_t *self,
+		cbst_node_t *parent, cbst_node_t *node, int prune)
+{
+	_Atomic(cbst_node_t *) *slot = CBST_SLOT(tree, parent, node->n);
+	cbst_node_t *left, *right;
+	int removed;
+
+	if (parent->unlinked || node->unlinked || atomic_load(slot) != node)
+		return (-1);
+	if (prune && !atomic_load(&node->deleted))
+		return (0);
+	removed = !atomic_exchange(&node->deleted, 1);
+	left = atomic_load(&node->left);
+	right = atomic_load(&node->right);
+	if (left != NULL && right != NULL)
+		return (removed);
+	node->unlinked = 1;
+	atomic_store(slot, left != NULL ? left : right);
+	cbst_retire(tree, self, node);
+	return (removed);
+}
+
+/**
+ * cbst_remove - removes a value from a concurrent BST
+ * @tree: pointer to the tree
+ * @self: slot of the calling thread
+ * @value: value to remove
+ *
+ * Description: locks the node holding value and its parent, always in
+ * that top-down order so that writers cannot deadlock. A node only loses
+ * a child when that child is spliced out, so after a splice the parent
+ * is pruned in a second pass if it is a marked routing node: marked nodes
+ * with fewer than two children never outlive the removal that made them.
+ * Splicing the parent does not take a child from the grandparent, so one
+ * level is enough.
+ * Return: 1 if value was removed, 0 if it was not in the tree
+ */
+int cbst_remove(cbst_t *tree, cbst_thread_t *self, int value)
+{
+	cbst_node_t *node, *parent;
+	int ret, removed = 0, prune, spliced = 0;
+
+	cbst_enter(tree, self);
+	for (prune = 0; prune < 2; prune++)
+	{
+		ret = -1;
+		while (ret < 0)
+		{
+			node = cbst_locate(tree, value, &parent);
+			spliced = 0;
+			if (node == NULL)
+				break;
+			pthread_mutex_lock(&parent->lock);
+			pthread_mutex_lock(&node->lock);
+			ret = cbst_unlink(tree, self, parent, node, prune);
+			spliced = ret >= 0 && node->unlinked;
+			pthread_mutex_unlock(&node->lock);
+			pthread_mutex_unlock(&parent->lock);
+		}
+		removed = prune ? removed : ret > 0;
+		if (!spliced || parent == &tree->head ||
+		    !atomic_load(&parent->deleted))
+			break;
+		value = parent->n;
+	}
+	cbst_leave(self);
+	return (removed);
+}
@@ -0,0 +1,128 @@
+#include "binary_trees.h"
+
+/* nodes encoded before each fwrite */
+#define BST_FLAT_CHUNK 4096
+
+/**
+ * flat_push - remembers a node whose right child is not reached yet
+ * @open: pointer to the stack of pre-order positions, grown as needed
+ * @cap: pointer to the capacity of the stack
+ * @depth: number of positions on the stack
+ * @i: pre-order position of the node
+ * Return: 1 on success, 0 on failure
+ */
+static int flat_push(size_t **open, size_t *cap, size_t depth, size_t i)
+{
+	size_t *grown;
+
+	if (depth == *cap)
+	{
+		grown = realloc(*open, sizeof(**open) * (*cap ? *cap * 2 : 64));
+		if (grown == NULL)
+			return (0);
+		*open = grown;
+		*cap = *cap ? *cap * 2 : 64;
+	}
+	(*open)[depth] = i;
+	return (1);
+}
+
+/**
+ * flat_link - sets the right child index of a node encoded earlier
+ * @file: file being written
+ * @chunk: nodes encoded but not written yet
+ * @base: pre-order position of chunk[0]
+ * @parent: pre-order position of the node
+ * @child: pre-order position of its right child
+ *
+ * Description: the node is patched in the chunk while it is there, and
+ * in the file once the chunk holding it has been written.
+ * Return: 1 on success, 0 on failure
+ */
+static int flat_link(FILE *file, bst_flat_node_t *chunk, size_t base,
+		size_t parent, size_t child)
+{
+	uint32_t index = (uint32_t)child;
+	long offset;
+
+	if (parent >= base)
+	{
+		chunk[parent - base].right = index;
+		return (1);
+	}
+	offset = (long)(sizeof(bst_flat_header_t) +
+			parent * sizeof(bst_flat_node_t) +
+			offsetof(bst_flat_node_t, right));
+	return (fseek(file, offset, SEEK_SET) == 0 &&
+		fwrite(&index, sizeof(index), 1, file) == 1 &&
+		fseek(file, 0, SEEK_END) == 0);
+}
+
+/**
+ * flat_encode - encodes a node at its pre-order position
+ * @node: pointer to the node
+ * @i: pre-order position of the node
+ * @out: pointer to the flat node to fill
+ *
+ * Description: in pre-order the left child comes right after its parent.
+ * The right child comes after the whole left subtree, so its index is
+ * only known once it is reached, and flat_link fills it in then.
+ */
+static void flat_encode(const binary_tree_t *node, size_t i,
+		bst_flat_node_t *out)
+{
+	out->n = node->n;
+	out->left = node->left != NULL ? (uint32_t)(i + 1) : BST_FLAT_NONE;
+	out->right = BST_FLAT_NONE;
+}
+
+/**
+ * bst_flat_save - writes a BST (or AVL tree) to a flat tree file
+ * @tree: pointer to the root node of the tree
+ * @path: path of the file to create or truncate
+ *
+ * Description: the file is a bst_flat_header_t followed by one
+ * bst_flat_node_t per node in pre-order, in the byte order of the machine.
+ * The shape is kept as is, so the tree comes back balanced without any
+ * rotation, and bst_flat_map can use the file in place. The nodes still
+ * waiting for the index of their right child form a stack, which is at
+ * most as deep as the tree.
+ * Return: 1 on success, 0 on failure
+ */
+int bst_flat_save(const bst_t *tree, const char *path)
+{
+	bst_flat_node_t chunk[BST_FLAT_CHUNK];
+	bst_flat_header_t header = {BST_FLAT_MAGIC, 0, 0, 0};
+	const binary_tree_t *node;
+	size_t i = 0, fill = 0, *open = NULL, depth = 0, cap = 0;
+	FILE *file;
+	int ok;
+
+	i = node_size(tree);
+	if (i >= BST_FLAT_NONE)
+		return (0);
+	header.size = (uint32_t)i;
+	header.height = (uint32_t)node_height(tree);
+	file = fopen(path, "wb");
+	if (file == NULL)
+		return (0);
+	ok = fwrite(&header, sizeof(header), 1, file) == 1;
+	for (node = tree, i = 0; ok && node != NULL;
+	     node = preorder_next(node, tree))
+	{
+		if ((node != tree && node == node->parent->right &&
+		     !flat_link(file, chunk, i - fill, open[--depth], i)) ||
+		    (node->right != NULL &&
+		     !flat_push(&open, &cap, depth++, i)))
+			break;
+		flat_encode(node, i++, &chunk[fill++]);
+		if (fill == BST_FLAT_CHUNK || i == header.size)
+		{
+			ok = fwrite(chunk, sizeof(chunk[0]), fill, file) == fill;
+			fill = 0;
+		}
+	}
+	free(open);
+	ok = fclose(file) == 0 && ok && i == header.size;
+	return (ok);
+}
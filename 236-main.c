@@ -0,0 +1,112 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * random_key - draws a pseudo-random key
+ *
+ * Return: the key
+ */
+static int random_key(void)
+{
+    return ((int)((((unsigned int)rand() << 15) ^ rand()) & 0x3fffffff));
+}
+
+/**
+ * lookups - runs the same lookups on an AVL tree and on a mapped view
+ * @tree: pointer to the root node of the tree
+ * @flat: pointer to the view of the same tree
+ * @keys: keys the tree was built from
+ * @n: number of keys
+ *
+ * Return: 0 if both agree on every lookup, 1 otherwise
+ */
+static int lookups(const avl_t *tree, const bst_flat_t *flat,
+                   const int *keys, size_t n)
+{
+    size_t i, hits[2] = {0, 0};
+    double t[2];
+    clock_t start;
+    int key;
+
+    srand(402);
+    start = clock();
+    for (i = 0; i < n; i++)
+        hits[0] += bst_search(tree, i & 1 ? random_key()
+                              : keys[(size_t)random_key() % n]) != NULL;
+    t[0] = seconds(start);
+    srand(402);
+    start = clock();
+    for (i = 0; i < n; i++)
+    {
+        key = i & 1 ? random_key() : keys[(size_t)random_key() % n];
+        hits[1] += bst_flat_search(flat, key) != NULL;
+    }
+    t[1] = seconds(start);
+    printf("%lu lookups: AVL %.3fs, mapped %.3fs, %lu hits\n",
+           (unsigned long)n, t[0], t[1], (unsigned long)hits[1]);
+    return (hits[0] != hits[1]);
+}
+
+/**
+ * main - compares rebuilding an AVL tree from its values with saving it
+ * once and then loading or mapping the saved file
+ * @ac: argument count
+ * @av: av[1] number of values (default 1000000), av[2] file path
+ * (default /tmp/236-tree.bin)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000, i;
+    const char *path = ac > 2 ? av[2] : "/tmp/236-tree.bin";
+    int *keys = malloc(sizeof(int) * (n ? n : 1)), ret;
+    avl_t *tree, *loaded;
+    binary_tree_stats_t a, b;
+    bst_flat_t flat;
+    clock_t start;
+
+    if (!keys)
+        return (1);
+    srand(98);
+    for (i = 0; i < n; i++)
+        keys[i] = random_key();
+    start = clock();
+    tree = array_to_avl(keys, n);
+    printf("array_to_avl: %.3fs\n", seconds(start));
+    start = clock();
+    if (!bst_flat_save(tree, path))
+        return (1);
+    printf("bst_flat_save: %.3fs\n", seconds(start));
+    start = clock();
+    if (!bst_flat_map(path, &flat))
+        return (1);
+    printf("bst_flat_map: %.6fs, %lu nodes, %lu bytes, height %lu\n",
+           seconds(start), (unsigned long)flat.size,
+           (unsigned long)flat.length, (unsigned long)flat.height);
+    start = clock();
+    loaded = bst_flat_load(&flat);
+    printf("bst_flat_load: %.3fs\n", seconds(start));
+    binary_tree_stats(tree, &a);
+    binary_tree_stats(loaded, &b);
+    ret = a.size != b.size || a.height != b.height || a.sum != b.sum ||
+          !b.avl || (n && lookups(tree, &flat, keys, n));
+    bst_flat_unmap(&flat);
+    binary_tree_delete(tree);
+    binary_tree_delete(loaded);
+    free(keys);
+    return (ret);
+}
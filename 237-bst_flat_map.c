@@ -0,0 +1,85 @@
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "binary_trees.h"
+
+/**
+ * bst_flat_map - maps a flat tree file read-only, without copying it
+ * @path: path of the file written by bst_flat_save
+ * @flat: pointer to the view to fill
+ *
+ * Description: only the header is checked, so mapping costs the same
+ * whatever the size of the tree; pages are read when searches touch
+ * them. bst_flat_search stays in bounds even on a corrupt file.
+ * Return: 1 on success, 0 on failure
+ */
+int bst_flat_map(const char *path, bst_flat_t *flat)
+{
+	const bst_flat_header_t *header;
+	struct stat st;
+	void *map;
+	int fd = open(path, O_RDONLY);
+
+	if (fd < 0)
+		return (0);
+	if (fstat(fd, &st) != 0 || (size_t)st.st_size < sizeof(*header))
+	{
+		close(fd);
+		return (0);
+	}
+	map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED)
+		return (0);
+	header = map;
+	if (header->magic != BST_FLAT_MAGIC || (size_t)st.st_size !=
+	    sizeof(*header) + header->size * sizeof(bst_flat_node_t))
+	{
+		munmap(map, st.st_size);
+		return (0);
+	}
+	flat->nodes = (const bst_flat_node_t *)(header + 1);
+	flat->size = header->size;
+	flat->height = header->height;
+	flat->map = map;
+	flat->length = st.st_size;
+	return (1);
+}
+
+/**
+ * bst_flat_unmap - releases a flat tree view
+ * @flat: pointer to the view
+ */
+void bst_flat_unmap(bst_flat_t *flat)
+{
+	if (flat->map != NULL)
+		munmap(flat->map, flat->length);
+	flat->map = NULL;
+	flat->nodes = NULL;
+	flat->size = flat->length = 0;
+}
+
+/**
+ * bst_flat_search - searches a value in a flat tree view
+ * @flat: pointer to the view
+ * @value: value to look for
+ *
+ * Description: children always come after their parent in pre-order, so
+ * a walk whose index does not grow, or leaves the file, is cut short.
+ * Return: pointer to the node holding value, or NULL if there is none
+ */
+const bst_flat_node_t *bst_flat_search(const bst_flat_t *flat, int value)
+{
+	size_t i = 0, next;
+
+	while (i < flat->size && flat->nodes[i].n != value)
+	{
+		next = value < flat->nodes[i].n ? flat->nodes[i].left :
+			flat->nodes[i].right;
+		if (next <= i)
+			return (NULL);
+		i = next;
+	}
+	return (i < flat->size ? &flat->nodes[i] : NULL);
+}
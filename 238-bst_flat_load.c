@@ -0,0 +1,81 @@
+#include "binary_trees.h"
+
+/**
+ * flat_link - hangs a rebuilt child under its parent
+ * @nodes: rebuilt nodes not yet linked, by pre-order position
+ * @i: position of the parent
+ * @child: position of the child, BST_FLAT_NONE if there is none
+ * @slot: pointer to the child link of the parent
+ * Return: 1 on success, 0 if child is not a free node after the parent
+ */
+static int flat_link(binary_tree_t **nodes, size_t i, uint32_t child,
+		binary_tree_t **slot)
+{
+	if (child == BST_FLAT_NONE)
+		return (1);
+	if (child <= i || nodes[child] == NULL)
+		return (0);
+	*slot = nodes[child];
+	nodes[child]->parent = nodes[i];
+	nodes[child] = NULL;
+	return (1);
+}
+
+/**
+ * flat_build - rebuilds one node of a flat tree view
+ * @nodes: rebuilt nodes not yet linked, by pre-order position
+ * @flat: pointer to the view
+ * @i: position of the node; every later node is already rebuilt
+ * Return: 1 on success, 0 on failure
+ */
+static int flat_build(binary_tree_t **nodes, const bst_flat_t *flat,
+		size_t i)
+{
+	const bst_flat_node_t *in = &flat->nodes[i];
+
+	nodes[i] = binary_tree_node(NULL, in->n);
+	if (nodes[i] == NULL || (in->left != BST_FLAT_NONE &&
+				 in->left >= flat->size) ||
+	    (in->right != BST_FLAT_NONE && in->right >= flat->size))
+		return (0);
+	if (!flat_link(nodes, i, in->left, &nodes[i]->left) ||
+	    !flat_link(nodes, i, in->right, &nodes[i]->right))
+		return (0);
+	node_update(nodes[i]);
+	return (1);
+}
+
+/**
+ * bst_flat_load - rebuilds a mutable tree from a flat tree view
+ * @flat: pointer to the view
+ *
+ * Description: nodes are built from the last position to the first, so
+ * children exist before their parent and the cached heights and sizes
+ * are set in the same pass; the shape, balanced or not, is kept and no
+ * rotation runs. Use bst_flat_search on the view instead when the tree
+ * is only read.
+ * Return: pointer to the root node of the new tree, or NULL if the view
+ * is empty, malformed, or on failure
+ */
+avl_t *bst_flat_load(const bst_flat_t *flat)
+{
+	binary_tree_t **nodes;
+	avl_t *root;
+	size_t i;
+	int ok = 1;
+
+	if (flat->size == 0)
+		return (NULL);
+	nodes = calloc(flat->size, sizeof(*nodes));
+	if (nodes == NULL)
+		return (NULL);
+	for (i = flat->size; ok && i-- > 0;)
+		ok = flat_build(nodes, flat, i);
+	for (i = 1; ok && i < flat->size; i++)
+		ok = nodes[i] == NULL;
+	for (i = 0; !ok && i < flat->size; i++)
+		binary_tree_delete(nodes[i]);
+	root = ok ? nodes[0] : NULL;
+	free(nodes);
+	return (root);
+}
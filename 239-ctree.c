@@ -0,0 +1,99 @@
+#include "binary_trees.h"
+
+/**
+ * ctree_init - initializes an empty compact tree
+ * @tree: pointer to the tree
+ * @balanced: 1 for an AVL tree, 0 for a plain BST
+ */
+void ctree_init(ctree_t *tree, int balanced)
+{
+	static ctree_node_t nil;
+
+	tree->nodes = &nil;
+	tree->cap = 1;
+	tree->used = 1;
+	tree->free_list = CTREE_NIL;
+	tree->root = CTREE_NIL;
+	tree->size = 0;
+	tree->balanced = balanced;
+	tree->path = NULL;
+	tree->path_cap = 0;
+}
+
+/**
+ * ctree_free - releases the storage of a compact tree and empties it
+ * @tree: pointer to the tree
+ */
+void ctree_free(ctree_t *tree)
+{
+	if (tree->cap > 1)
+		free(tree->nodes);
+	free(tree->path);
+	ctree_init(tree, tree->balanced);
+}
+
+/**
+ * ctree_node_new - takes a node out of the pool of a compact tree
+ * @tree: pointer to the tree
+ * @value: value to put in the node
+ *
+ * Description: the pool doubles when it is full, which moves the nodes:
+ * hold indices into it, never pointers, across this call.
+ * Return: index of the new leaf, or CTREE_NIL on failure
+ */
+uint32_t ctree_node_new(ctree_t *tree, int value)
+{
+	ctree_node_t *nodes;
+	uint32_t i = tree->free_list, cap;
+
+	if (i != CTREE_NIL)
+		tree->free_list = tree->nodes[i].left;
+	else if (tree->used < tree->cap)
+		i = tree->used++;
+	else
+	{
+		if (tree->cap >= UINT32_MAX / 2)
+			return (CTREE_NIL);
+		cap = tree->cap < 64 ? 64 : tree->cap * 2;
+		nodes = realloc(tree->cap > 1 ? tree->nodes : NULL,
+				sizeof(*nodes) * cap);
+		if (nodes == NULL)
+			return (CTREE_NIL);
+		if (tree->cap == 1)
+			nodes[CTREE_NIL] = tree->nodes[CTREE_NIL];
+		tree->nodes = nodes;
+		tree->cap = cap;
+		i = tree->used++;
+	}
+	tree->nodes[i].n = value;
+	tree->nodes[i].left = tree->nodes[i].right = CTREE_NIL;
+	tree->nodes[i].height = 1;
+	return (i);
+}
+
+/**
+ * ctree_node_del - gives a node back to the pool of a compact tree
+ * @tree: pointer to the tree
+ * @i: index of the node, already unlinked
+ */
+void ctree_node_del(ctree_t *tree, uint32_t i)
+{
+	tree->nodes[i].left = tree->free_list;
+	tree->free_list = i;
+}
+
+/**
+ * ctree_search - searches a value in a compact tree
+ * @tree: pointer to the tree
+ * @value: value to look for
+ * Return: index of the node holding value, or CTREE_NIL if it is absent
+ */
+uint32_t ctree_search(const ctree_t *tree, int value)
+{
+	const ctree_node_t *nodes = tree->nodes;
+	uint32_t i = tree->root;
+
+	while (i != CTREE_NIL && nodes[i].n != value)
+		i = value < nodes[i].n ? nodes[i].left : nodes[i].right;
+	return (i);
+}
@@ -0,0 +1,138 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * pointer_run - inserts, looks up and removes keys in a pointer tree
+ * @keys: keys to insert, the first half of them is removed afterwards
+ * @n: number of keys
+ * @avl: 1 for avl_insert/avl_remove, 0 for bst_insert/bst_remove
+ * @t: pointer to store the insert, lookup and remove times
+ *
+ * Return: number of values left in the tree
+ */
+static size_t pointer_run(const int *keys, size_t n, int avl, double *t)
+{
+    tree_pool_t *pool = tree_pool_create(4096);
+    binary_tree_t *tree = NULL;
+    size_t i, hits = 0, left;
+    clock_t start;
+
+    if (!pool)
+        return (0);
+    tree_alloc_set(&pool->alloc);
+    start = clock();
+    for (i = 0; i < n; i++)
+    {
+        if (avl)
+            avl_insert(&tree, keys[i]);
+        else
+            bst_insert(&tree, keys[i]);
+    }
+    t[0] = seconds(start);
+    start = clock();
+    for (i = 0; i < n; i++)
+        hits += bst_search(tree, keys[(i * 7919) % n]) != NULL;
+    t[1] = seconds(start);
+    start = clock();
+    for (i = 0; i < n / 2; i++)
+        tree = avl ? avl_remove(tree, keys[i]) : bst_remove(tree, keys[i]);
+    t[2] = seconds(start);
+    left = node_size(tree);
+    printf("pointer %-4s %lu bytes/node, peak %lu MB, insert %.3fs, "
+           "lookup %.3fs, remove %.3fs\n", avl ? "AVL" : "BST",
+           (unsigned long)sizeof(binary_tree_t),
+           (unsigned long)(n * sizeof(binary_tree_t) >> 20), t[0], t[1],
+           t[2]);
+    binary_tree_delete(tree);
+    tree_alloc_set(NULL);
+    tree_pool_destroy(pool);
+    return (hits == n ? left : 0);
+}
+
+/**
+ * compact_run - runs the same work as pointer_run on a compact tree
+ * @keys: keys to insert, the first half of them is removed afterwards
+ * @n: number of keys
+ * @avl: 1 for an AVL tree, 0 for a plain BST
+ * @t: pointer to store the insert, lookup and remove times
+ *
+ * Return: number of values left in the tree
+ */
+static size_t compact_run(const int *keys, size_t n, int avl, double *t)
+{
+    ctree_t tree;
+    size_t i, hits = 0, left;
+    clock_t start;
+
+    ctree_init(&tree, avl);
+    start = clock();
+    for (i = 0; i < n; i++)
+        ctree_insert(&tree, keys[i]);
+    t[0] = seconds(start);
+    start = clock();
+    for (i = 0; i < n; i++)
+        hits += ctree_search(&tree, keys[(i * 7919) % n]) != CTREE_NIL;
+    t[1] = seconds(start);
+    start = clock();
+    for (i = 0; i < n / 2; i++)
+        ctree_remove(&tree, keys[i]);
+    t[2] = seconds(start);
+    left = tree.size;
+    printf("compact %-4s %lu bytes/node, peak %lu MB, insert %.3fs, "
+           "lookup %.3fs, remove %.3fs\n", avl ? "AVL" : "BST",
+           (unsigned long)sizeof(ctree_node_t),
+           (unsigned long)(tree.cap * sizeof(ctree_node_t) >> 20), t[0],
+           t[1], t[2]);
+    ctree_free(&tree);
+    return (hits == n ? left : 0);
+}
+
+/**
+ * main - compares the pointer and compact node layouts on the same BST
+ * and AVL workloads
+ * @ac: argument count
+ * @av: av[1] number of distinct random keys (default 2000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 2000000, i, j;
+    int *keys = malloc(sizeof(int) * (n ? n : 1)), avl, tmp, ret = 0;
+    double tp[3] = {0}, tc[3] = {0};
+
+    if (!keys || n == 0)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)i;
+    srand(98);
+    for (i = n - 1; i > 0; i--)
+    {
+        j = (((size_t)rand() << 15) ^ rand()) % (i + 1);
+        tmp = keys[i];
+        keys[i] = keys[j];
+        keys[j] = tmp;
+    }
+    for (avl = 0; avl <= 1; avl++)
+    {
+        ret |= pointer_run(keys, n, avl, tp) != n - n / 2;
+        ret |= compact_run(keys, n, avl, tc) != n - n / 2;
+        printf("speedup insert %.2fx, lookup %.2fx, remove %.2fx\n",
+               tp[0] / tc[0], tp[1] / tc[1], tp[2] / tc[2]);
+    }
+    free(keys);
+    return (ret);
+}
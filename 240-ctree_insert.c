@@ -0,0 +1,155 @@
+#include "binary_trees.h"
+
+/**
+ * ctree_push - stores a node on the path of a compact tree walk
+ * @tree: pointer to the tree
+ * @depth: depth of the node
+ * @i: index of the node
+ * Return: 1 on success, 0 on failure
+ */
+int ctree_push(ctree_t *tree, size_t depth, uint32_t i)
+{
+	uint32_t *path;
+	size_t cap;
+
+	if (depth >= tree->path_cap)
+	{
+		cap = tree->path_cap != 0 ? tree->path_cap * 2 : 64;
+		path = realloc(tree->path, sizeof(*path) * cap);
+		if (path == NULL)
+			return (0);
+		tree->path = path;
+		tree->path_cap = cap;
+	}
+	tree->path[depth] = i;
+	return (1);
+}
+
+/**
+ * ctree_relink - replaces the node at some depth of the path by another
+ * @tree: pointer to the tree
+ * @depth: depth of the node on the path
+ * @old: index of the node, a child of path[depth - 1] or the root
+ * @i: index of the node taking its place, may be CTREE_NIL
+ */
+void ctree_relink(ctree_t *tree, size_t depth, uint32_t old, uint32_t i)
+{
+	ctree_node_t *parent;
+
+	if (depth == 0)
+	{
+		tree->root = i;
+		return;
+	}
+	parent = &tree->nodes[tree->path[depth - 1]];
+	if (parent->left == old)
+		parent->left = i;
+	else
+		parent->right = i;
+}
+
+/**
+ * ctree_rotate - rotates a node of a compact tree with one of its children
+ * @nodes: node pool of the tree
+ * @i: index of the node, which goes down
+ * @right: 1 to rotate right (the left child goes up), 0 to rotate left
+ * Return: index of the new subtree root
+ */
+static uint32_t ctree_rotate(ctree_node_t *nodes, uint32_t i, int right)
+{
+	uint32_t pivot = right ? nodes[i].left : nodes[i].right;
+	int l, r;
+
+	if (right)
+	{
+		nodes[i].left = nodes[pivot].right;
+		nodes[pivot].right = i;
+	}
+	else
+	{
+		nodes[i].right = nodes[pivot].left;
+		nodes[pivot].left = i;
+	}
+	l = nodes[nodes[i].left].height;
+	r = nodes[nodes[i].right].height;
+	nodes[i].height = (l > r ? l : r) + 1;
+	l = nodes[nodes[pivot].left].height;
+	r = nodes[nodes[pivot].right].height;
+	nodes[pivot].height = (l > r ? l : r) + 1;
+	return (pivot);
+}
+
+/**
+ * ctree_fix - refreshes heights up the path after a leaf was added or
+ * removed below it, rotating unbalanced nodes of an AVL tree
+ * @tree: pointer to the tree
+ * @depth: number of nodes on the path to refresh
+ *
+ * Description: stops at the first subtree whose height is unchanged,
+ * since nothing above it can change either.
+ */
+void ctree_fix(ctree_t *tree, size_t depth)
+{
+	ctree_node_t *nodes = tree->nodes;
+	uint32_t i, sub, l, r;
+	int old, bal;
+
+	while (depth-- > 0)
+	{
+		sub = i = tree->path[depth];
+		old = nodes[i].height;
+		l = nodes[i].left;
+		r = nodes[i].right;
+		bal = tree->balanced ? nodes[l].height - nodes[r].height : 0;
+		if (bal > 1 && nodes[nodes[l].left].height <
+		    nodes[nodes[l].right].height)
+			nodes[i].left = ctree_rotate(nodes, l, 0);
+		else if (bal < -1 && nodes[nodes[r].right].height <
+			 nodes[nodes[r].left].height)
+			nodes[i].right = ctree_rotate(nodes, r, 1);
+		if (bal > 1 || bal < -1)
+			sub = ctree_rotate(nodes, i, bal > 1);
+		else
+			nodes[i].height = (nodes[l].height > nodes[r].height ?
+					   nodes[l].height : nodes[r].height) + 1;
+		if (sub != i)
+			ctree_relink(tree, depth, i, sub);
+		if (nodes[sub].height == old)
+			break;
+	}
+}
+
+/**
+ * ctree_insert - inserts a value in a compact tree
+ * @tree: pointer to the tree
+ * @value: value to insert
+ * Return: 1 if value was inserted, 0 if it was already present, -1 on
+ * failure
+ */
+int ctree_insert(ctree_t *tree, int value)
+{
+	uint32_t i = tree->root, leaf;
+	size_t depth = 0;
+
+	while (i != CTREE_NIL)
+	{
+		if (tree->nodes[i].n == value)
+			return (0);
+		if (!ctree_push(tree, depth++, i))
+			return (-1);
+		i = value < tree->nodes[i].n ? tree->nodes[i].left :
+			tree->nodes[i].right;
+	}
+	leaf = ctree_node_new(tree, value);
+	if (leaf == CTREE_NIL)
+		return (-1);
+	if (depth == 0)
+		tree->root = leaf;
+	else if (value < tree->nodes[tree->path[depth - 1]].n)
+		tree->nodes[tree->path[depth - 1]].left = leaf;
+	else
+		tree->nodes[tree->path[depth - 1]].right = leaf;
+	tree->size++;
+	ctree_fix(tree, depth);
+	return (1);
+}
@@ -0,0 +1,75 @@
+#include "binary_trees.h"
+
+/**
+ * ctree_remove - removes a value from a compact tree
+ * @tree: pointer to the tree
+ * @value: value to remove
+ *
+ * Description: a node with two children takes the value of its in-order
+ * successor, which is unlinked instead.
+ * Return: 1 if value was removed, 0 if it was not in the tree, -1 on
+ * failure
+ */
+int ctree_remove(ctree_t *tree, int value)
+{
+	ctree_node_t *nodes = tree->nodes;
+	uint32_t i = tree->root, next;
+	size_t depth = 0;
+
+	while (i != CTREE_NIL && nodes[i].n != value)
+	{
+		if (!ctree_push(tree, depth++, i))
+			return (-1);
+		i = value < nodes[i].n ? nodes[i].left : nodes[i].right;
+	}
+	if (i == CTREE_NIL || !ctree_push(tree, depth++, i))
+		return (i == CTREE_NIL ? 0 : -1);
+	if (nodes[i].left != CTREE_NIL && nodes[i].right != CTREE_NIL)
+	{
+		for (next = nodes[i].right; ; next = nodes[next].left)
+		{
+			if (!ctree_push(tree, depth++, next))
+				return (-1);
+			if (nodes[next].left == CTREE_NIL)
+				break;
+		}
+		nodes[i].n = nodes[next].n;
+		i = next;
+	}
+	ctree_relink(tree, depth - 1, i, nodes[i].left != CTREE_NIL ?
+		     nodes[i].left : nodes[i].right);
+	ctree_node_del(tree, i);
+	tree->size--;
+	ctree_fix(tree, depth - 1);
+	return (1);
+}
+
+/**
+ * ctree_inorder - goes through a compact tree using in-order traversal
+ * @tree: pointer to the tree
+ * @func: pointer to a function to call for each value, which must not
+ * change the tree
+ *
+ * Description: the path kept in the tree replaces the parent links.
+ * Return: 1 on success, 0 on failure
+ */
+int ctree_inorder(ctree_t *tree, void (*func)(int))
+{
+	uint32_t i = tree->root;
+	size_t depth = 0;
+
+	while (i != CTREE_NIL || depth > 0)
+	{
+		if (i != CTREE_NIL)
+		{
+			if (!ctree_push(tree, depth++, i))
+				return (0);
+			i = tree->nodes[i].left;
+			continue;
+		}
+		i = tree->path[--depth];
+		func(tree->nodes[i].n);
+		i = tree->nodes[i].right;
+	}
+	return (1);
+}
@@ -0,0 +1,138 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+#include "tree_map.h"
+
+/**
+ * struct point_s - payload stored next to each key
+ * @x: first coordinate
+ * @y: second coordinate
+ */
+typedef struct point_s
+{
+    int x;
+    int y;
+} point_t;
+
+#define STR_LESS(a, b) (strcmp(a, b) < 0)
+
+TREE_MAP_DECLARE(int_map, int, point_t, TREE_MAP_LESS)
+TREE_MAP_DECLARE(str_map, const char *, int, STR_LESS)
+
+/**
+ * seconds - converts a clock() interval to seconds
+ * @start: clock() value at the start of the interval
+ *
+ * Return: elapsed seconds
+ */
+static double seconds(clock_t start)
+{
+    return ((double)(clock() - start) / CLOCKS_PER_SEC);
+}
+
+/**
+ * print_entry - foreach callback printing a string-keyed entry
+ * @key: key of the entry
+ * @value: pointer to the value of the entry
+ * @arg: unused
+ */
+static void print_entry(const char *key, int *value, void *arg)
+{
+    (void)arg;
+    printf("%s=%d ", key, *value);
+}
+
+/**
+ * bench - times int keys in an int_map against avl_insert and bst_search
+ * @keys: keys to insert and look up
+ * @n: number of keys
+ *
+ * Return: 0 if both trees agree, 1 otherwise
+ */
+static int bench(const int *keys, size_t n)
+{
+    avl_t *tree = NULL;
+    int_map_t map;
+    point_t p, *found;
+    size_t i, hits[2] = {0, 0};
+    double t[4];
+    clock_t start;
+
+    start = clock();
+    for (i = 0; i < n; i++)
+        avl_insert(&tree, keys[i]);
+    t[0] = seconds(start);
+    start = clock();
+    for (i = 0; i < n; i++)
+        hits[0] += bst_search(tree, keys[(i * 7919) % n] + (int)(i & 1))
+                   != NULL;
+    t[1] = seconds(start);
+    int_map_init(&map);
+    start = clock();
+    for (i = 0; i < n; i++)
+    {
+        p.x = keys[i];
+        p.y = (int)i;
+        int_map_put(&map, keys[i], p);
+    }
+    t[2] = seconds(start);
+    start = clock();
+    for (i = 0; i < n; i++)
+    {
+        found = int_map_get(&map, keys[(i * 7919) % n] + (int)(i & 1));
+        hits[1] += found != NULL;
+    }
+    t[3] = seconds(start);
+    printf("%lu int keys: avl_insert %.3fs, bst_search %.3fs; "
+           "int_map put %.3fs, get %.3fs; %lu hits\n", (unsigned long)n,
+           t[0], t[1], t[2], t[3], (unsigned long)hits[1]);
+    i = node_size(tree);
+    binary_tree_delete(tree);
+    int_map_clear(&map);
+    return (hits[0] != hits[1] || i != n);
+}
+
+/**
+ * main - shows a string-keyed map, then compares an int-keyed map with the
+ * int AVL tree
+ * @ac: argument count
+ * @av: av[1] number of keys (default 1000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000, i;
+    const char *words[] = {"pear", "apple", "fig", "kiwi", "apple", "lime"};
+    str_map_t map;
+    int *keys, count, ret;
+
+    str_map_init(&map);
+    for (i = 0; i < sizeof(words) / sizeof(words[0]); i++)
+    {
+        count = str_map_get(&map, words[i]) ? *str_map_get(&map, words[i]) : 0;
+        str_map_put(&map, words[i], count + 1);
+    }
+    str_map_remove(&map, "fig", &count);
+    str_map_foreach(&map, print_entry, NULL);
+    printf("(%lu entries, fig was %d)\n", (unsigned long)map.size, count);
+    str_map_clear(&map);
+
+    keys = malloc(sizeof(int) * (n ? n : 1));
+    if (!keys || n == 0)
+        return (1);
+    for (i = 0; i < n; i++)
+        keys[i] = (int)(i * 2);
+    srand(98);
+    for (i = n - 1; i > 0; i--)
+    {
+        ret = (int)((((size_t)rand() << 15) ^ rand()) % (i + 1));
+        count = keys[i];
+        keys[i] = keys[ret];
+        keys[ret] = count;
+    }
+    ret = bench(keys, n);
+    free(keys);
+    return (ret);
+}
@@ -0,0 +1,111 @@
+#include <math.h>
+#include "binary_trees.h"
+
+/**
+ * bench_next - draws the next number of a xorshift64* generator
+ * @state: pointer to the state of the generator, never 0
+ * Return: a pseudo-random 64-bit number
+ */
+static uint64_t bench_next(uint64_t *state)
+{
+	uint64_t x = *state;
+
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*state = x;
+	return (x * 2685821657736338717ULL);
+}
+
+/**
+ * bench_zeta - computes the sum of 1 / i^theta for i from 1 to n
+ * @n: number of terms
+ * @theta: exponent
+ * Return: the sum
+ */
+static double bench_zeta(size_t n, double theta)
+{
+	double sum = 0;
+	size_t i;
+
+	for (i = 1; i <= n; i++)
+		sum += 1 / pow((double)i, theta);
+	return (sum);
+}
+
+/**
+ * bench_zipf - fills an array with keys whose frequencies follow Zipf's law
+ * @keys: array to fill
+ * @n: number of keys, also the number of distinct keys that can come up
+ * @state: pointer to the state of the generator
+ *
+ * Description: ranks are drawn with the inverse approximation of Gray et
+ * al. (SIGMOD 1994), as YCSB does, then scattered over the int range by a
+ * multiplication that is one-to-one modulo 2^31.
+ */
+static void bench_zipf(int *keys, size_t n, uint64_t *state)
+{
+	double theta = BENCH_ZIPF_THETA, zetan = bench_zeta(n, theta);
+	double zeta2 = 1 + pow(0.5, theta), alpha = 1 / (1 - theta), eta, u;
+	size_t i, rank;
+
+	eta = (1 - pow(2.0 / n, 1 - theta)) / (1 - zeta2 / zetan);
+	for (i = 0; i < n; i++)
+	{
+		u = (bench_next(state) >> 11) / 9007199254740992.0;
+		if (u * zetan < 1)
+			rank = 0;
+		else if (u * zetan < zeta2)
+			rank = 1;
+		else
+			rank = (size_t)(n * pow(eta * u - eta + 1, alpha));
+		if (rank >= n)
+			rank = n - 1;
+		keys[i] = (int)(((uint32_t)rank * 2654435761u) & INT_MAX);
+	}
+}
+
+/**
+ * bench_keys - fills an array with the keys of a benchmark workload
+ * @keys: array to fill
+ * @n: number of keys
+ * @dist: BENCH_RANDOM (uniform over the non-negative ints), BENCH_SORTED
+ * (0 to n - 1), BENCH_REVERSED (n - 1 down to 0) or BENCH_ZIPF
+ * @seed: seed of the random distributions, the same seed gives the same
+ * keys
+ * Return: 1 on success, 0 if dist is unknown
+ */
+int bench_keys(int *keys, size_t n, int dist, uint64_t seed)
+{
+	uint64_t state = seed << 1 | 1;
+	size_t i;
+
+	if (dist == BENCH_ZIPF)
+		bench_zipf(keys, n, &state);
+	else if (dist < BENCH_RANDOM || dist > BENCH_REVERSED)
+		return (0);
+	for (i = 0; dist != BENCH_ZIPF && i < n; i++)
+	{
+		if (dist == BENCH_RANDOM)
+			keys[i] = (int)(bench_next(&state) >> 33);
+		else
+			keys[i] = (int)(dist == BENCH_SORTED ? i : n - 1 - i);
+	}
+	return (1);
+}
+
+/**
+ * bench_dist_name - names a key distribution
+ * @dist: distribution, see bench_keys
+ * Return: the name, NULL if dist is unknown
+ */
+const char *bench_dist_name(int dist)
+{
+	static const char * const names[] = {
+		"random", "sorted", "reversed", "zipf"
+	};
+
+	if (dist < 0 || dist >= BENCH_DISTS)
+		return (NULL);
+	return (names[dist]);
+}
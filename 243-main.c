@@ -0,0 +1,134 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/* operations timed on every tree, in the order they run */
+static const tree_bench_op_t ops[] = {
+    {"insert", bench_insert},
+    {"search", bench_search},
+    {"inorder", bench_inorder},
+    {"levelorder", bench_levelorder},
+    {"height", bench_height},
+    {"remove", bench_remove},
+    {"delete", bench_delete}
+};
+
+#define OPS (sizeof(ops) / sizeof(ops[0]))
+
+/**
+ * wall - reads a monotonic wall clock
+ *
+ * Return: seconds since an arbitrary point
+ */
+static double wall(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * print_row - prints the result of one operation as CSV or JSON
+ * @bench: pointer to the benchmark the operation ran on
+ * @op: index of the operation in ops
+ * @dist: key distribution
+ * @t: best time of the operation, in seconds
+ * @json: 1 for a JSON object, 0 for a CSV line
+ */
+static void print_row(const tree_bench_t *bench, size_t op, int dist,
+                      double t, int json)
+{
+    static const char *const fmt[] = {
+        "%s,%s,%s,%lu,%.6f,%.2f,%lu\n",
+        "  {\"op\": \"%s\", \"tree\": \"%s\", \"dist\": \"%s\", \"n\": %lu, "
+        "\"seconds\": %.6f, \"ns_per_key\": %.2f, \"checksum\": %lu}"
+    };
+    static const char *const kinds[] = {"bst", "avl", "map"};
+    static int rows;
+
+    if (json)
+        printf("%s", rows++ ? ",\n" : "");
+    printf(fmt[json], ops[op].name, kinds[bench->kind],
+           bench_dist_name(dist), (unsigned long)bench->n, t,
+           t * 1e9 / bench->n, (unsigned long)bench->sink);
+}
+
+/**
+ * run_case - times every operation on one tree, keeping the best of
+ * several runs, and prints the results
+ * @bench: pointer to the benchmark, with its keys and tree kind set
+ * @dist: key distribution of the keys
+ * @reps: number of runs
+ * @json: 1 for JSON output, 0 for CSV
+ */
+static void run_case(tree_bench_t *bench, int dist, int reps, int json)
+{
+    double best[OPS], t;
+    size_t sums[OPS], op;
+    int rep;
+
+    for (rep = 0; rep < reps; rep++)
+    {
+        bench->tree = NULL;
+        for (op = 0; op < OPS; op++)
+        {
+            bench->sink = 0;
+            t = wall();
+            ops[op].run(bench);
+            t = wall() - t;
+            if (rep == 0 || t < best[op])
+                best[op] = t;
+            sums[op] = bench->sink;
+        }
+    }
+    for (op = 0; op < OPS; op++)
+    {
+        bench->sink = sums[op];
+        print_row(bench, op, dist, best[op], json);
+    }
+}
+
+/**
+ * main - times the tree operations over sizes growing tenfold from 1000
+ * and over every key distribution, then prints the results
+ * @ac: argument count
+ * @av: av[1] largest size (default 1000000), av[2] number of runs to keep
+ * the best of (default 3), av[3] "csv" (default) or "json"
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t max = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000, n;
+    int reps = ac > 2 ? atoi(av[2]) : 3, *keys, dist, json;
+    tree_bench_t bench;
+
+    json = ac > 3 && !strcmp(av[3], "json");
+    if (reps < 1)
+        return (1);
+    printf("%s", json ? "[\n" :
+           "op,tree,dist,n,seconds,ns_per_key,checksum\n");
+    for (n = 1000; n <= max; n *= 10)
+    {
+        keys = malloc(sizeof(int) * n);
+        if (!keys)
+            return (1);
+        for (dist = 0; dist < BENCH_DISTS; dist++)
+        {
+            bench_keys(keys, n, dist, 98);
+            bench.keys = keys;
+            bench.n = n;
+            for (bench.kind = 0; bench.kind < BENCH_KINDS; bench.kind++)
+                if (bench.kind != BENCH_BST || n <= BENCH_DEGENERATE_MAX ||
+                    dist == BENCH_RANDOM || dist == BENCH_ZIPF)
+                    run_case(&bench, dist, reps, json);
+        }
+        free(keys);
+        fflush(stdout);
+    }
+    printf("%s", json ? "\n]\n" : "");
+    return (0);
+}
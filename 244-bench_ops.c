@@ -0,0 +1,91 @@
+#include "binary_trees.h"
+#include "tree_map.h"
+
+/* BENCH_MAP trees; only the root is kept, map sizes are never read */
+TREE_MAP_DECLARE(bench_map, int, int, TREE_MAP_LESS)
+
+/**
+ * bench_insert - builds the tree of a benchmark by inserting every key
+ * @bench: pointer to the benchmark, whose tree must be NULL
+ */
+void bench_insert(tree_bench_t *bench)
+{
+	bench_map_t map = {NULL, 0};
+	binary_tree_t *node;
+	size_t i;
+
+	for (i = 0; i < bench->n; i++)
+	{
+		if (bench->kind == BENCH_MAP)
+			bench->sink += bench_map_put(&map, bench->keys[i],
+					bench->keys[i]) == 1;
+		else
+		{
+			if (bench->kind == BENCH_AVL)
+				node = avl_insert(&bench->tree, bench->keys[i]);
+			else
+				node = bst_insert(&bench->tree, bench->keys[i]);
+			bench->sink += node != NULL;
+		}
+	}
+	if (bench->kind == BENCH_MAP)
+		bench->tree = map.root;
+}
+
+/**
+ * bench_search - looks up every key in the tree of a benchmark
+ * @bench: pointer to the benchmark
+ */
+void bench_search(tree_bench_t *bench)
+{
+	bench_map_t map = {bench->tree, 0};
+	size_t i;
+
+	for (i = 0; i < bench->n; i++)
+	{
+		if (bench->kind == BENCH_MAP)
+			bench->sink += bench_map_get(&map,
+					bench->keys[i]) != NULL;
+		else
+			bench->sink += bst_search(bench->tree,
+					bench->keys[i]) != NULL;
+	}
+}
+
+/**
+ * bench_remove - removes every other key from the tree of a benchmark
+ * @bench: pointer to the benchmark
+ */
+void bench_remove(tree_bench_t *bench)
+{
+	bench_map_t map = {bench->tree, 0};
+	size_t i;
+
+	for (i = 0; i < bench->n; i += 2)
+	{
+		if (bench->kind == BENCH_MAP)
+			bench_map_remove(&map, bench->keys[i], NULL);
+		else if (bench->kind == BENCH_AVL)
+			bench->tree = avl_remove(bench->tree, bench->keys[i]);
+		else
+			bench->tree = bst_remove(bench->tree, bench->keys[i]);
+	}
+	if (bench->kind == BENCH_MAP)
+		bench->tree = map.root;
+	bench->sink += node_size(bench->tree);
+}
+
+/**
+ * bench_delete - frees the tree of a benchmark
+ * @bench: pointer to the benchmark
+ */
+void bench_delete(tree_bench_t *bench)
+{
+	bench_map_t map = {bench->tree, 0};
+
+	if (bench->kind == BENCH_MAP)
+		bench_map_clear(&map);
+	else
+		binary_tree_delete(bench->tree);
+	bench->tree = NULL;
+}
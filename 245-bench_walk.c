@@ -0,0 +1,44 @@
+#include "binary_trees.h"
+
+/* sum of the values seen by bench_visit */
+static size_t bench_visits;
+
+/**
+ * bench_visit - traversal callback adding a value to bench_visits
+ * @n: value of the node
+ */
+static void bench_visit(int n)
+{
+	bench_visits += (size_t)n;
+}
+
+/**
+ * bench_inorder - walks the tree of a benchmark in order
+ * @bench: pointer to the benchmark
+ */
+void bench_inorder(tree_bench_t *bench)
+{
+	bench_visits = 0;
+	binary_tree_inorder(bench->tree, bench_visit);
+	bench->sink += bench_visits;
+}
+
+/**
+ * bench_levelorder - walks the tree of a benchmark level by level
+ * @bench: pointer to the benchmark
+ */
+void bench_levelorder(tree_bench_t *bench)
+{
+	bench_visits = 0;
+	binary_tree_levelorder(bench->tree, bench_visit);
+	bench->sink += bench_visits;
+}
+
+/**
+ * bench_height - measures the tree of a benchmark with binary_tree_height
+ * @bench: pointer to the benchmark
+ */
+void bench_height(tree_bench_t *bench)
+{
+	bench->sink += binary_tree_height(bench->tree);
+}
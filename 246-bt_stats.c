@@ -0,0 +1,67 @@
+#include "binary_trees.h"
+
+#ifdef BT_INSTRUMENT
+/* counters of the calling thread, bumped by BT_COUNT and BT_DEPTH */
+_Thread_local bt_stats_t bt_stats_local;
+#endif
+
+/**
+ * bt_stats_get - copies the counters of the calling thread
+ * @stats: pointer to store the counters, all 0 when instrumentation is
+ * compiled out
+ * Return: 1 if the library was built with BT_INSTRUMENT, 0 otherwise
+ */
+int bt_stats_get(bt_stats_t *stats)
+{
+#ifdef BT_INSTRUMENT
+	*stats = bt_stats_local;
+	return (1);
+#else
+	memset(stats, 0, sizeof(*stats));
+	return (0);
+#endif
+}
+
+/**
+ * bt_stats_reset - sets the counters of the calling thread back to 0
+ */
+void bt_stats_reset(void)
+{
+#ifdef BT_INSTRUMENT
+	memset(&bt_stats_local, 0, sizeof(bt_stats_local));
+#endif
+}
+
+/**
+ * bt_stats_merge - adds the counters of one thread to a total
+ * @sum: pointer to the total
+ * @stats: pointer to the counters to add, as read by bt_stats_get
+ *
+ * Description: max_depth keeps the larger of the two depths.
+ */
+void bt_stats_merge(bt_stats_t *sum, const bt_stats_t *stats)
+{
+	sum->compares += stats->compares;
+	sum->visits += stats->visits;
+	sum->rotations += stats->rotations;
+	sum->double_rotations += stats->double_rotations;
+	sum->height_updates += stats->height_updates;
+	sum->allocs += stats->allocs;
+	sum->frees += stats->frees;
+	if (stats->max_depth > sum->max_depth)
+		sum->max_depth = stats->max_depth;
+}
+
+/**
+ * bt_stats_depth - raises the max_depth counter of the calling thread
+ * @depth: depth of a node just reached
+ */
+void bt_stats_depth(size_t depth)
+{
+#ifdef BT_INSTRUMENT
+	if (depth > bt_stats_local.max_depth)
+		bt_stats_local.max_depth = depth;
+#else
+	(void)depth;
+#endif
+}
@@ -0,0 +1,109 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * struct job_s - work of one thread
+ * @n: number of keys to insert, look up and free
+ * @dist: key distribution, see bench_keys
+ * @stats: counters of the thread once it is done
+ */
+typedef struct job_s
+{
+    size_t n;
+    int dist;
+    bt_stats_t stats;
+} job_t;
+
+/**
+ * wall - reads a monotonic wall clock
+ *
+ * Return: seconds since an arbitrary point
+ */
+static double wall(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * worker - builds an AVL tree, looks up every key and frees the tree, then
+ * reads the counters of its thread
+ * @arg: pointer to the job_t of the thread
+ *
+ * Return: NULL
+ */
+static void *worker(void *arg)
+{
+    job_t *job = arg;
+    avl_t *tree = NULL;
+    int *keys = malloc(sizeof(int) * (job->n ? job->n : 1));
+    size_t i;
+
+    if (!keys)
+        return (NULL);
+    bench_keys(keys, job->n, job->dist, 98);
+    bt_stats_reset();
+    for (i = 0; i < job->n; i++)
+        avl_insert(&tree, keys[i]);
+    for (i = 0; i < job->n; i++)
+        bst_search(tree, keys[i]);
+    binary_tree_delete(tree);
+    bt_stats_get(&job->stats);
+    free(keys);
+    return (NULL);
+}
+
+/**
+ * print_stats - prints one set of counters on a line
+ * @label: name of the line
+ * @s: pointer to the counters
+ */
+static void print_stats(const char *label, const bt_stats_t *s)
+{
+    printf("%-8s compares %lu, visits %lu, rotations %lu (double %lu), "
+           "height updates %lu, allocs %lu, frees %lu, max depth %lu\n",
+           label, (unsigned long)s->compares, (unsigned long)s->visits,
+           (unsigned long)s->rotations, (unsigned long)s->double_rotations,
+           (unsigned long)s->height_updates, (unsigned long)s->allocs,
+           (unsigned long)s->frees, (unsigned long)s->max_depth);
+}
+
+/**
+ * main - runs sorted and random AVL workloads on two threads and
+ * prints the counters of each thread and their sum
+ * @ac: argument count
+ * @av: av[1] number of keys per thread (default 1000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 1000000;
+    job_t jobs[2] = {{0, BENCH_SORTED, {0}}, {0, BENCH_RANDOM, {0}}};
+    pthread_t threads[2];
+    bt_stats_t sum = {0};
+    double t = wall();
+    int i, on = bt_stats_get(&sum);
+
+    for (i = 0; i < 2; i++)
+    {
+        jobs[i].n = n;
+        if (pthread_create(&threads[i], NULL, worker, &jobs[i]) != 0)
+            return (1);
+    }
+    for (i = 0; i < 2; i++)
+        pthread_join(threads[i], NULL);
+    t = wall() - t;
+    printf("instrumentation %s, %lu keys per thread, %.3fs\n",
+           on ? "on" : "off", (unsigned long)n, t);
+    print_stats("sorted", &jobs[0].stats);
+    print_stats("random", &jobs[1].stats);
+    for (i = 0; i < 2; i++)
+        bt_stats_merge(&sum, &jobs[i].stats);
+    print_stats("total", &sum);
+    return (0);
+}
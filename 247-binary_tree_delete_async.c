@@ -0,0 +1,110 @@
+#include "binary_trees.h"
+
+/*
+ * trees waiting for the reaper thread, chained through their root's parent;
+ * only trees of malloc'd nodes are queued
+ */
+static binary_tree_t *reap_list;
+/* 1 while the reaper is freeing a tree it took off reap_list */
+static int reap_busy;
+/* 1 once the reaper thread runs, -1 if it could not be started */
+static int reap_state;
+static pthread_mutex_t reap_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t reap_work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t reap_idle = PTHREAD_COND_INITIALIZER;
+
+/**
+ * reaper - background thread freeing the trees queued by
+ * binary_tree_delete_async
+ * @arg: unused
+ * Return: never returns
+ */
+static void *reaper(void *arg)
+{
+	binary_tree_t *tree;
+
+	(void)arg;
+	pthread_mutex_lock(&reap_lock);
+	while (1)
+	{
+		while (reap_list == NULL)
+		{
+			reap_busy = 0;
+			pthread_cond_broadcast(&reap_idle);
+			pthread_cond_wait(&reap_work, &reap_lock);
+		}
+		tree = reap_list;
+		reap_list = tree->parent;
+		reap_busy = 1;
+		pthread_mutex_unlock(&reap_lock);
+		tree->parent = NULL;
+		binary_tree_delete_to(tree, NULL);
+		pthread_mutex_lock(&reap_lock);
+	}
+	return (NULL);
+}
+
+/**
+ * reaper_start - starts the reaper thread the first time it is needed
+ *
+ * Description: must be called with reap_lock held.
+ * Return: 1 if the reaper runs, 0 if it could not be started
+ */
+static int reaper_start(void)
+{
+	pthread_t thread;
+
+	if (reap_state == 0)
+	{
+		reap_state = -1;
+		if (pthread_create(&thread, NULL, reaper, NULL) == 0)
+		{
+			pthread_detach(thread);
+			reap_state = 1;
+		}
+	}
+	return (reap_state == 1);
+}
+
+/**
+ * binary_tree_delete_async - hands a tree over to a background thread that
+ * deletes it, so that dropping a large tree does not stall the caller
+ * @tree: pointer to the root node of the tree to delete, may be NULL
+ *
+ * Description: the tree must not be used anymore, nor be part of another
+ * tree, and its nodes must come from the allocator the calling thread has
+ * selected. The reaper frees queued trees with free() whatever allocator
+ * is selected later on. Pools are not safe to free into from another
+ * thread, so with a pool selected the tree is deleted right away, as it
+ * is if the thread cannot be started.
+ */
+void binary_tree_delete_async(binary_tree_t *tree)
+{
+	tree_alloc_t *alloc = tree_alloc_get();
+
+	if (tree == NULL)
+		return;
+	pthread_mutex_lock(&reap_lock);
+	if (alloc != NULL || !reaper_start())
+	{
+		pthread_mutex_unlock(&reap_lock);
+		binary_tree_delete_to(tree, alloc);
+		return;
+	}
+	tree->parent = reap_list;
+	reap_list = tree;
+	pthread_cond_signal(&reap_work);
+	pthread_mutex_unlock(&reap_lock);
+}
+
+/**
+ * binary_tree_delete_wait - waits until every tree handed to
+ * binary_tree_delete_async so far has been freed
+ */
+void binary_tree_delete_wait(void)
+{
+	pthread_mutex_lock(&reap_lock);
+	while (reap_state == 1 && (reap_list != NULL || reap_busy))
+		pthread_cond_wait(&reap_idle, &reap_lock);
+	pthread_mutex_unlock(&reap_lock);
+}
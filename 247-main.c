@@ -0,0 +1,158 @@
+#include <stdlib.h>
+#include <stdio.h>
+#include <time.h>
+#include "binary_trees.h"
+
+/**
+ * wall - reads a monotonic wall clock
+ *
+ * Return: seconds since an arbitrary point
+ */
+static double wall(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+/**
+ * recursive_delete - the previous binary_tree_delete, for comparison
+ * @tree: pointer to the root node of the tree to delete
+ */
+static void recursive_delete(binary_tree_t *tree)
+{
+    if (tree == NULL)
+        return;
+    recursive_delete(tree->left);
+    recursive_delete(tree->right);
+    tree_node_free(tree);
+}
+
+/**
+ * chain - builds a tree where every node has one child, the shape
+ * array_to_bst gives to sorted (right) or reversed (left) input
+ * @n: number of nodes
+ * @left: 1 to hang every node on the left of its parent, 0 on the right
+ *
+ * Return: pointer to the root node, NULL on failure
+ */
+static binary_tree_t *chain(size_t n, int left)
+{
+    binary_tree_t *root = NULL, *node = NULL, *child;
+    size_t i;
+
+    for (i = 0; i < n; i++)
+    {
+        child = binary_tree_node(node, left ? (int)(n - i) : (int)i);
+        if (!child)
+            break;
+        if (!node)
+            root = child;
+        else if (left)
+            node->left = child;
+        else
+            node->right = child;
+        node = child;
+    }
+    return (root);
+}
+
+/**
+ * balanced - builds a balanced tree of n values with sorted_array_to_avl
+ * @n: number of nodes
+ *
+ * Return: pointer to the root node, NULL on failure
+ */
+static binary_tree_t *balanced(size_t n)
+{
+    int *array = malloc(sizeof(int) * (n ? n : 1));
+    binary_tree_t *tree;
+    size_t i;
+
+    if (!array)
+        return (NULL);
+    for (i = 0; i < n; i++)
+        array[i] = (int)i;
+    tree = sorted_array_to_avl(array, n);
+    free(array);
+    return (tree);
+}
+
+/**
+ * switch_test - selects a pool while a malloc'd tree waits to be deleted in
+ * the background, then deletes a pool tree with the pool selected
+ * @n: number of nodes of each tree
+ *
+ * Return: 0 if neither tree was freed into the wrong allocator, 1 otherwise
+ */
+static int switch_test(size_t n)
+{
+    tree_pool_t *pool = tree_pool_create(0);
+    binary_tree_t *tree = balanced(n);
+    int ret;
+
+    if (!pool || !tree)
+        return (1);
+    binary_tree_delete_async(tree);
+    tree_alloc_set(&pool->alloc);
+    binary_tree_delete_wait();
+    ret = pool->live != 0 || pool->free_list != NULL;
+    tree = balanced(n);
+    binary_tree_delete_async(tree);
+    binary_tree_delete_wait();
+    ret |= !tree || pool->live != 0;
+    printf("allocator switched during a background delete: %s\n",
+           ret ? "FAILED" : "OK");
+    tree_pool_destroy(pool);
+    return (ret);
+}
+
+/**
+ * main - deletes degenerate trees too deep for the recursive delete,
+ * compares recursive, iterative and background deletion of a balanced tree,
+ * then checks background deletion against allocator switches
+ * @ac: argument count
+ * @av: av[1] number of nodes of each tree (default 5000000)
+ *
+ * Return: 0 on success, 1 on failure
+ */
+int main(int ac, char **av)
+{
+    size_t n = ac > 1 ? strtoul(av[1], NULL, 10) : 5000000;
+    binary_tree_t *tree;
+    double t[4];
+    int left;
+
+    for (left = 0; left <= 1; left++)
+    {
+        tree = chain(n, left);
+        if (!tree)
+            return (1);
+        t[0] = wall();
+        binary_tree_delete(tree);
+        printf("%s chain of %lu nodes deleted in %.3fs\n",
+               left ? "left" : "right", (unsigned long)n, wall() - t[0]);
+    }
+    tree = balanced(n);
+    t[0] = wall();
+    recursive_delete(tree);
+    t[0] = wall() - t[0];
+    tree = balanced(n);
+    t[1] = wall();
+    binary_tree_delete(tree);
+    t[1] = wall() - t[1];
+    tree = balanced(n);
+    if (!tree)
+        return (1);
+    t[2] = wall();
+    binary_tree_delete_async(tree);
+    t[2] = wall() - t[2];
+    t[3] = wall();
+    binary_tree_delete_wait();
+    t[3] = wall() - t[3] + t[2];
+    printf("balanced tree of %lu nodes: recursive %.3fs, iterative %.3fs, "
+           "async %.6fs in the caller (%.3fs until freed)\n",
+           (unsigned long)n, t[0], t[1], t[2], t[3]);
+    return (switch_test(n < 200000 ? n : 200000));
+}
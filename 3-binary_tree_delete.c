@@ -1,21 +1,46 @@
 #include "binary_trees.h"
 
 /**
- * binary_tree_delete - deletes an entire binary tree
+ * binary_tree_delete_to - deletes an entire binary tree, giving its nodes
+ * back to the allocator that created them
  * @tree: pointer to the root node of the tree to delete
+ * @alloc: allocator of the nodes, NULL for malloc/free
  * If tree is NULL, do nothing
+ *
+ * Description: while the current node has a left child, a right rotation
+ * lifts that child above it; once it has none, the node is freed and its
+ * right child becomes current. The tree is thus unrolled into a list and
+ * freed in O(n) time with no recursion or stack, however deep it is. The
+ * parent links are not read.
  */
-void binary_tree_delete(binary_tree_t *tree)
+void binary_tree_delete_to(binary_tree_t *tree, tree_alloc_t *alloc)
 {
-	if (tree == NULL)
-		return;
-
-	/* delete left subtree */
-	binary_tree_delete(tree->left);
+	binary_tree_t *next;
 
-	/* delete right subtree */
-	binary_tree_delete(tree->right);
+	while (tree != NULL)
+	{
+		if (tree->left != NULL)
+		{
+			next = tree->left;
+			tree->left = next->right;
+			next->right = tree;
+		}
+		else
+		{
+			next = tree->right;
+			tree_node_free_to(alloc, tree);
+		}
+		tree = next;
+	}
+}
 
-	/* free the current node */
-	free(tree);
+/**
+ * binary_tree_delete - deletes an entire binary tree built with the
+ * allocator the calling thread has selected
+ * @tree: pointer to the root node of the tree to delete
+ * If tree is NULL, do nothing
+ */
+void binary_tree_delete(binary_tree_t *tree)
+{
+	binary_tree_delete_to(tree, tree_alloc_get());
 }
@@ -11,13 +11,12 @@
  */
 void binary_tree_preorder(const binary_tree_t *tree, void (*func)(int))
 {
+	const binary_tree_t *node;
+
 	if (tree == NULL || func == NULL)
 		return;
 
-	/* call function for the current node */
-	func(tree->n);
-	/* traverse the left subtree in pre-order */
-	binary_tree_preorder(tree->left, func);
-	/* traverse the right subtree in pre-order */
-	binary_tree_preorder(tree->right, func);
+	/* walk the parent links, so depth never limits the traversal */
+	for (node = tree; node != NULL; node = preorder_next(node, tree))
+		func(node->n);
 }
@@ -9,13 +9,13 @@
  */
 void binary_tree_inorder(const binary_tree_t *tree, void (*func)(int))
 {
+	const binary_tree_t *node;
+
 	if (tree == NULL || func == NULL)
 		return;
 
-	/* traverse the left subtree in in-order */
-	binary_tree_inorder(tree->left, func);
-	/* call the function to the current node */
-	func(tree->n);
-	/* traverse the right subtree in in-order */
-	binary_tree_inorder(tree->right, func);
+	/* walk the parent links, so depth never limits the traversal */
+	node = inorder_first(tree);
+	for (; node != NULL; node = inorder_next(node, tree))
+		func(node->n);
 }
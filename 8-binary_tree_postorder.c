@@ -10,13 +10,13 @@
  */
 void binary_tree_postorder(const binary_tree_t *tree, void (*func)(int))
 {
+	const binary_tree_t *node;
+
 	if (tree == NULL || func == NULL)
 		return;
 
-	/* traverse the left subtree in post-order */
-	binary_tree_postorder(tree->left, func);
-	/* traverse the right subtree in post-order */
-	binary_tree_postorder(tree->right, func);
-	/* call the fuction for the current node */
-	func(tree->n);
+	/* walk the parent links, so depth never limits the traversal */
+	node = postorder_first(tree);
+	for (; node != NULL; node = postorder_next(node, tree))
+		func(node->n);
 }
@@ -0,0 +1,79 @@
+#include "binary_trees.h"
+
+/*
+ * allocator used by binary_tree_node() and tree_node_free() in the calling
+ * thread, NULL means plain malloc/free; each thread selects its own
+ */
+static _Thread_local tree_alloc_t *current_alloc;
+
+/**
+ * tree_alloc_set - selects the allocator used for every tree node the
+ * calling thread creates or frees
+ * @alloc: allocator to use, or NULL to go back to malloc/free
+ *
+ * Nodes must be freed through the allocator that created them: either
+ * with that allocator selected in the freeing thread, or explicitly with
+ * tree_node_free_to() and binary_tree_delete_to(). Switch allocators only
+ * between trees, never in the middle of one. A tree_pool_t is not
+ * thread-safe, so select it in one thread at a time.
+ * Return: the allocator the calling thread had selected before
+ */
+tree_alloc_t *tree_alloc_set(tree_alloc_t *alloc)
+{
+	tree_alloc_t *prev = current_alloc;
+
+	current_alloc = alloc;
+	return (prev);
+}
+
+/**
+ * tree_alloc_get - reads the allocator the calling thread uses for tree
+ * nodes
+ * Return: the allocator selected with tree_alloc_set, NULL for malloc/free
+ */
+tree_alloc_t *tree_alloc_get(void)
+{
+	return (current_alloc);
+}
+
+/**
+ * tree_node_alloc - gets storage for one node from the current allocator
+ * Return: pointer to uninitialized node storage, or NULL on failure
+ */
+binary_tree_t *tree_node_alloc(void)
+{
+	binary_tree_t *node;
+
+	if (current_alloc == NULL)
+		node = malloc(sizeof(binary_tree_t));
+	else
+		node = current_alloc->alloc(current_alloc->ctx);
+	BT_COUNT(allocs, node != NULL);
+	return (node);
+}
+
+/**
+ * tree_node_free_to - gives a node back to the allocator that created it
+ * @alloc: that allocator, NULL for malloc/free
+ * @node: node to release, may be NULL
+ */
+void tree_node_free_to(tree_alloc_t *alloc, binary_tree_t *node)
+{
+	if (node == NULL)
+		return;
+	BT_COUNT(frees, 1);
+	if (alloc == NULL)
+		free(node);
+	else
+		alloc->free(alloc->ctx, node);
+}
+
+/**
+ * tree_node_free - gives a node back to the allocator the calling thread
+ * has selected, which must be the one that created it
+ * @node: node to release, may be NULL
+ */
+void tree_node_free(binary_tree_t *node)
+{
+	tree_node_free_to(current_alloc, node);
+}
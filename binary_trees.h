@@ -4,13 +4,22 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <stddef.h>
+#include <stdint.h>
 #include <limits.h>
 #include <string.h>
+#include <pthread.h>
+#include <stdatomic.h>
 
 /**
  * struct binary_tree_s - Binary tree node
  *
  * @n: Integer stored in the node
+ * @height: Cached height of the subtree rooted at the node (a leaf is 1),
+ * maintained by the BST and AVL functions and the rotations; red-black
+ * trees keep their colour here instead
+ * @size: Cached number of nodes in the subtree rooted at the node,
+ * maintained alongside @height; only there when the library is built with
+ * -DBT_ORDER_STATS, which makes a node 40 bytes instead of 32
  * @parent: Pointer to the parent node
  * @left: Pointer to the left child node
  * @right: Pointer to the right child node
@@ -19,6 +28,9 @@ struct binary_tree_s
 {
 	int n;
 	int height;
+#ifdef BT_ORDER_STATS
+	size_t size;
+#endif
 	struct binary_tree_s *parent;
 	struct binary_tree_s *left;
 	struct binary_tree_s *right;
@@ -35,40 +47,663 @@ typedef struct binary_tree_s avl_t;
 /* Max Binary Heap */
 typedef struct binary_tree_s heap_t;
 
-/* the queue node */
+/* Red-Black Tree, the colour (RB_RED or RB_BLACK) replaces the height */
+typedef struct binary_tree_s rb_t;
+
+#define RB_BLACK 0
+#define RB_RED 1
+#define RB_COLOUR(node) ((node) != NULL ? (node)->height : RB_BLACK)
+
+/**
+ * struct tree_alloc_s - pluggable allocator for tree nodes
+ * @alloc: returns storage for one binary_tree_t, or NULL on failure
+ * @free: gives back storage obtained from @alloc
+ * @ctx: opaque state passed to both callbacks
+ */
+typedef struct tree_alloc_s
+{
+	void *(*alloc)(void *ctx);
+	void (*free)(void *ctx, void *ptr);
+	void *ctx;
+} tree_alloc_t;
+
 /**
- * struct queue_node - structure for a node in the queue
- * @data: data of the node
- * @node: pointer to the next node
+ * struct bt_stats_s - hot-path counters of one thread, kept only when the
+ * library is built with -DBT_INSTRUMENT
+ * @compares: key comparisons made while descending a tree
+ * @visits: nodes visited by the descents
+ * @rotations: single rotations, i.e. calls to binary_tree_rotate_left and
+ * binary_tree_rotate_right, including the two halves of a double rotation
+ * @double_rotations: left-right and right-left cases of avl_insert
+ * @height_updates: cached heights (and sizes) recomputed by node_update
+ * @allocs: nodes obtained from tree_node_alloc
+ * @frees: nodes given back to tree_node_free
+ * @max_depth: depth of the deepest node reached, the root being at 0
  */
-typedef struct queue_node
+typedef struct bt_stats_s
 {
-	const binary_tree_t *data;
-	struct queue_node *next;
-} queue_node_t;
+	size_t compares;
+	size_t visits;
+	size_t rotations;
+	size_t double_rotations;
+	size_t height_updates;
+	size_t allocs;
+	size_t frees;
+	size_t max_depth;
+} bt_stats_t;
+
+/*
+ * BT_COUNT adds to a counter of the calling thread and BT_DEPTH raises its
+ * max_depth. Without BT_INSTRUMENT both expand to nothing and their
+ * arguments are never evaluated.
+ */
+#ifdef BT_INSTRUMENT
+extern _Thread_local bt_stats_t bt_stats_local;
+#define BT_COUNT(counter, k) ((void)(bt_stats_local.counter += (k)))
+#define BT_DEPTH(depth) bt_stats_depth(depth)
+#else
+#define BT_COUNT(counter, k) ((void)0)
+#define BT_DEPTH(depth) ((void)0)
+#endif
+
+/* hints that a cache line will be read soon; it cannot fault */
+#ifdef __GNUC__
+#define BST_PREFETCH(ptr) __builtin_prefetch(ptr)
+#else
+#define BST_PREFETCH(ptr) ((void)(ptr))
+#endif
 
 /**
- * struct queue - structure for the queue
- * @front: front of the queue
- * @rear: rear of the queue
+ * struct tree_slab_s - header of one slab of nodes in a pool
+ * @next: next slab in the pool
+ * @used: number of nodes handed out from this slab
+ */
+typedef struct tree_slab_s
+{
+	struct tree_slab_s *next;
+	size_t used;
+} tree_slab_t;
+
+/**
+ * struct tree_pool_s - slab/arena pool of tree nodes
+ * @slabs: list of slabs, most recent first
+ * @free_list: nodes given back to the pool, chained through ->left
+ * @per_slab: number of nodes carved out of each slab
+ * @live: number of nodes currently handed out
+ * @alloc: allocator hooks bound to this pool, see tree_alloc_set()
+ */
+typedef struct tree_pool_s
+{
+	tree_slab_t *slabs;
+	binary_tree_t *free_list;
+	size_t per_slab;
+	size_t live;
+	tree_alloc_t alloc;
+} tree_pool_t;
+
+/**
+ * struct queue - growable ring buffer of node pointers
+ * @buf: storage, its capacity is always a power of two
+ * @cap: number of slots in @buf
+ * @head: index of the front of the queue
+ * @count: number of queued nodes
  */
 typedef struct queue
 {
-	queue_node_t *front;
-	queue_node_t *rear;
+	const binary_tree_t **buf;
+	size_t cap;
+	size_t head;
+	size_t count;
 } queue_t;
 
+/**
+ * struct levelorder_iter_s - level-order iterator
+ * @queue: nodes waiting to be visited
+ * @remaining: nodes left to visit in the current level
+ * @level: depth of the last node returned, the root is level 0
+ */
+typedef struct levelorder_iter_s
+{
+	queue_t *queue;
+	size_t remaining;
+	size_t level;
+} levelorder_iter_t;
+
+/**
+ * struct bst_cursor_s - position in a BST, usable for range scans
+ * @root: pointer to the root node of the tree, or of the subtree the
+ * cursor is confined to
+ * @node: node under the cursor, NULL past the end of the tree
+ */
+typedef struct bst_cursor_s
+{
+	const bst_t *root;
+	bst_t *node;
+} bst_cursor_t;
+
+/**
+ * struct bst_frozen_s - read-only BST compiled to an Eytzinger array
+ * @keys: values in breadth-first order of a complete tree, 1-indexed:
+ * the children of keys[k] are keys[2k] and keys[2k + 1]; 64-byte aligned,
+ * so the 16 descendants of keys[k] four levels down share a cache line
+ * @size: number of values
+ */
+typedef struct bst_frozen_s
+{
+	int *keys;
+	size_t size;
+} bst_frozen_t;
+
+/* "BTF1" read as a native 32-bit integer; a byte-swapped magic means the
+ * file was written on a machine of the other endianness */
+#define BST_FLAT_MAGIC 0x31465442u
+#define BST_FLAT_NONE UINT32_MAX
+
+/**
+ * struct bst_flat_node_s - node of a flat tree file
+ * @n: value of the node
+ * @left: index of the left child, BST_FLAT_NONE if there is none
+ * @right: index of the right child, BST_FLAT_NONE if there is none
+ */
+typedef struct bst_flat_node_s
+{
+	int32_t n;
+	uint32_t left;
+	uint32_t right;
+} bst_flat_node_t;
+
+/**
+ * struct bst_flat_header_s - start of a flat tree file, followed by
+ * @size nodes in pre-order, so the root is node 0 and every child comes
+ * after its parent
+ * @magic: BST_FLAT_MAGIC
+ * @size: number of nodes
+ * @height: height of the tree
+ * @reserved: 0, pads the header to 16 bytes
+ */
+typedef struct bst_flat_header_s
+{
+	uint32_t magic;
+	uint32_t size;
+	uint32_t height;
+	uint32_t reserved;
+} bst_flat_header_t;
+
+/**
+ * struct bst_flat_s - read-only view of a flat tree file mapped in memory
+ * @nodes: nodes of the tree, inside the mapping
+ * @size: number of nodes
+ * @height: height of the tree
+ * @map: start of the mapping
+ * @length: length of the mapping
+ */
+typedef struct bst_flat_s
+{
+	const bst_flat_node_t *nodes;
+	size_t size;
+	size_t height;
+	void *map;
+	size_t length;
+} bst_flat_t;
+
+/* index of the shared empty node of a compact tree; it is never written */
+#define CTREE_NIL 0
+
+/**
+ * struct ctree_node_s - node of a compact tree: 16 bytes instead of the 32
+ * of a binary_tree_t (40 with BT_ORDER_STATS)
+ * @n: Integer stored in the node
+ * @left: index of the left child, CTREE_NIL if there is none; links the
+ * free list while the node is unused
+ * @right: index of the right child, CTREE_NIL if there is none
+ * @height: height of the subtree rooted at the node (a leaf is 1)
+ */
+typedef struct ctree_node_s
+{
+	int n;
+	uint32_t left;
+	uint32_t right;
+	int height;
+} ctree_node_t;
+
+/**
+ * struct ctree_s - BST or AVL tree whose nodes live in one array and link
+ * to each other by 32-bit index; there are no parent links, walks keep
+ * the path from the root in @path instead
+ * @nodes: node pool, nodes[CTREE_NIL] stands for every missing child
+ * @cap: number of slots in @nodes
+ * @used: number of slots ever handed out, CTREE_NIL included
+ * @free_list: first removed node available for reuse, CTREE_NIL if none
+ * @root: index of the root node, CTREE_NIL when the tree is empty
+ * @size: number of values in the tree
+ * @balanced: 1 to rebalance like an AVL tree, 0 for a plain BST
+ * @path: indices from the root down to the node being worked on
+ * @path_cap: number of slots in @path
+ */
+typedef struct ctree_s
+{
+	ctree_node_t *nodes;
+	uint32_t cap;
+	uint32_t used;
+	uint32_t free_list;
+	uint32_t root;
+	size_t size;
+	int balanced;
+	uint32_t *path;
+	size_t path_cap;
+} ctree_t;
+
+/* key distributions of bench_keys */
+#define BENCH_RANDOM 0
+#define BENCH_SORTED 1
+#define BENCH_REVERSED 2
+#define BENCH_ZIPF 3
+#define BENCH_DISTS 4
+
+/* skew of BENCH_ZIPF: the i-th most frequent key comes up ~ 1/i^0.99 */
+#define BENCH_ZIPF_THETA 0.99
+
+/* largest BST built from sorted keys: its insertion time is quadratic */
+#define BENCH_DEGENERATE_MAX 16384
+
+/* trees timed by the benchmark harness */
+#define BENCH_BST 0
+#define BENCH_AVL 1
+#define BENCH_MAP 2
+#define BENCH_KINDS 3
+
+/**
+ * struct tree_bench_s - state shared by the operations timed by the
+ * benchmark harness
+ * @keys: keys of the workload, in insertion order
+ * @n: number of keys
+ * @kind: BENCH_BST to build the tree with bst_insert, BENCH_AVL with
+ * avl_insert, BENCH_MAP as an int -> int map of tree_map.h
+ * @tree: tree built by bench_insert and freed by bench_delete
+ * @sink: results of the operations folded together and printed as a
+ * checksum, so that the compiler cannot drop any of the work
+ */
+typedef struct tree_bench_s
+{
+	const int *keys;
+	size_t n;
+	int kind;
+	binary_tree_t *tree;
+	size_t sink;
+} tree_bench_t;
+
+/**
+ * struct tree_bench_op_s - operation timed by the benchmark harness
+ * @name: name of the operation in the results
+ * @run: pointer to the function running it over all the keys
+ */
+typedef struct tree_bench_op_s
+{
+	const char *name;
+	void (*run)(tree_bench_t *bench);
+} tree_bench_op_t;
+
+/* keys per B-tree node: one 64-byte cache line of ints, minus one */
+#define BTREE_DEGREE 8
+#define BTREE_MAX_KEYS (2 * BTREE_DEGREE - 1)
+
+/**
+ * struct btree_node_s - wide node of an ordered set of ints
+ * @keys: sorted keys, the array fills one cache line
+ * @count: number of keys in use
+ * @leaf: 1 if the node has no children
+ * @child: child[i] holds the keys between keys[i - 1] and keys[i]
+ */
+typedef struct btree_node_s
+{
+	int keys[BTREE_MAX_KEYS + 1];
+	int count;
+	int leaf;
+	struct btree_node_s *child[BTREE_MAX_KEYS + 1];
+} btree_node_t;
+
+/**
+ * struct btree_s - B-tree ordered set of ints
+ * @root: pointer to the root node, NULL when empty
+ * @size: number of keys in the set
+ */
+typedef struct btree_s
+{
+	btree_node_t *root;
+	size_t size;
+} btree_t;
+
+/**
+ * struct binary_tree_stats_s - structural statistics of a binary tree
+ * @size: number of nodes
+ * @leaves: number of nodes without children
+ * @internal: number of nodes with at least one child
+ * @height: number of nodes on the longest downward path
+ * @min: smallest value in the tree
+ * @max: largest value in the tree
+ * @sum: sum of all values
+ * @full: 1 if every node has 0 or 2 children
+ * @perfect: 1 if the tree is full and all leaves are at the same depth
+ * @complete: 1 if every level is full except maybe the last, which is
+ * filled from the left
+ * @bst: 1 if the tree is a valid BST (strictly increasing in order)
+ * @avl: 1 if the tree is a valid BST with no balance violation
+ * @heap: 1 if the tree is complete and no node is smaller than a child
+ * @violations: number of nodes whose balance factor is not -1, 0 or 1
+ */
+typedef struct binary_tree_stats_s
+{
+	size_t size;
+	size_t leaves;
+	size_t internal;
+	size_t height;
+	int min;
+	int max;
+	long sum;
+	int full;
+	int perfect;
+	int complete;
+	int bst;
+	int avl;
+	int heap;
+	size_t violations;
+} binary_tree_stats_t;
+
+/**
+ * struct heap_array_s - max-heap stored level by level in an array
+ * @data: values, the children of data[i] are data[2i + 1] and data[2i + 2]
+ * @size: number of values
+ * @cap: number of values @data can hold
+ *
+ * A zero-initialized heap_array_t is an empty heap.
+ */
+typedef struct heap_array_s
+{
+	int *data;
+	size_t size;
+	size_t cap;
+} heap_array_t;
+
+/**
+ * struct pavl_node_s - node of a persistent AVL tree, shared between
+ * versions and never changed once reachable from one
+ * @n: Integer stored in the node
+ * @height: height of the subtree rooted at the node (a leaf is 1)
+ * @size: number of nodes in the subtree rooted at the node
+ * @refs: number of parents and version handles pointing at the node
+ * @left: Pointer to the left child node
+ * @right: Pointer to the right child node
+ */
+typedef struct pavl_node_s
+{
+	int n;
+	int height;
+	size_t size;
+	atomic_size_t refs;
+	struct pavl_node_s *left;
+	struct pavl_node_s *right;
+} pavl_node_t;
+
+#define PAVL_HEIGHT(node) ((node) != NULL ? (node)->height : 0)
+#define PAVL_SIZE(node) ((node) != NULL ? (node)->size : 0)
+
+/**
+ * struct pavl_cell_s - shared slot holding the current version of a
+ * persistent AVL tree
+ * @lock: held just long enough to read or swap @root with its reference
+ * @root: current version, NULL when empty
+ */
+typedef struct pavl_cell_s
+{
+	pthread_mutex_t lock;
+	pavl_node_t *root;
+} pavl_cell_t;
+
+/**
+ * struct cbst_node_s - node of a concurrent binary search tree
+ * @n: Integer stored in the node, never changed
+ * @deleted: 1 once the value is removed; the node may still route searches
+ * @unlinked: 1 once the node is out of the tree, under @lock
+ * @lock: taken by writers changing the node or its child links
+ * @left: Pointer to the left child node, read without the lock
+ * @right: Pointer to the right child node, read without the lock
+ * @limbo: next node retired by the same thread
+ * @epoch: epoch the node was retired in
+ */
+typedef struct cbst_node_s
+{
+	int n;
+	atomic_int deleted;
+	int unlinked;
+	pthread_mutex_t lock;
+	_Atomic(struct cbst_node_s *) left;
+	_Atomic(struct cbst_node_s *) right;
+	struct cbst_node_s *limbo;
+	unsigned long epoch;
+} cbst_node_t;
+
+/**
+ * struct cbst_thread_s - per-thread reclamation state of a concurrent BST
+ * @epoch: epoch announced by the thread, shifted left by one, with the low
+ * bit set while it is inside an operation
+ * @used: 1 while a thread owns the slot
+ * @limbo: nodes the thread unlinked, newest first, not yet freed
+ * @retired: number of nodes in @limbo
+ *
+ * Description: aligned on cache lines so that announcing an epoch does
+ * not invalidate the slots of other threads.
+ */
+typedef struct cbst_thread_s
+{
+	_Alignas(64) atomic_ulong epoch;
+	atomic_int used;
+	cbst_node_t *limbo;
+	size_t retired;
+} cbst_thread_t;
+
+#define CBST_MAX_THREADS 64
+
+/**
+ * struct cbst_s - concurrent binary search tree of distinct integers
+ * @head: sentinel whose right child is the root
+ * @epoch: global reclamation epoch
+ * @threads: slots of the registered threads
+ */
+typedef struct cbst_s
+{
+	cbst_node_t head;
+	atomic_ulong epoch;
+	cbst_thread_t threads[CBST_MAX_THREADS];
+} cbst_t;
+
+#define AVL_UNION 0
+#define AVL_INTERSECTION 1
+#define AVL_DIFFERENCE 2
+
+/**
+ * struct avl_setop_s - one half of a set operation, run on its own thread
+ * @a: first tree of the half
+ * @b: second tree of the half
+ * @op: AVL_UNION, AVL_INTERSECTION or AVL_DIFFERENCE
+ * @forks: number of extra threads the half may start
+ * @result: root of the combined half once done
+ */
+typedef struct avl_setop_s
+{
+	avl_t *a;
+	avl_t *b;
+	int op;
+	size_t forks;
+	avl_t *result;
+} avl_setop_t;
+
+struct ws_pool_s;
+
+/**
+ * struct ws_deque_s - range of task indices owned by one worker
+ * @lock: protects @lo and @hi against thieves
+ * @lo: next index the owner runs
+ * @hi: end of the range, thieves take the upper half
+ * @pool: pool the worker belongs to
+ * @id: index of the worker in the pool
+ */
+typedef struct ws_deque_s
+{
+	pthread_mutex_t lock;
+	size_t lo;
+	size_t hi;
+	struct ws_pool_s *pool;
+	size_t id;
+} ws_deque_t;
+
+/**
+ * struct ws_pool_s - pool of worker threads with work stealing
+ * @threads: worker threads
+ * @deques: one task range per worker
+ * @size: number of workers
+ * @lock: protects the fields below
+ * @work: signalled when a batch starts or the pool stops
+ * @done: signalled when the last worker runs out of tasks
+ * @fn: task function of the current batch
+ * @arg: argument passed to @fn
+ * @generation: number of batches started so far
+ * @active: number of workers still busy with the current batch
+ * @stop: set to make the workers exit
+ */
+typedef struct ws_pool_s
+{
+	pthread_t *threads;
+	ws_deque_t *deques;
+	size_t size;
+	pthread_mutex_t lock;
+	pthread_cond_t work;
+	pthread_cond_t done;
+	void (*fn)(void *arg, size_t i);
+	void *arg;
+	size_t generation;
+	size_t active;
+	int stop;
+} ws_pool_t;
+
+/* subtrees of at most this many nodes are reduced as one task */
+#define PTREE_GRAIN 8192
+/* ptree_spine_t subtree that is empty, or on the spine itself */
+#define PTREE_EMPTY ((size_t)-1)
+#define PTREE_SPINE ((size_t)-2)
+
+/**
+ * struct ptree_spine_s - node whose subtree is too large for one task, so
+ * it is folded back in on the calling thread
+ * @node: the node
+ * @sub: left and right subtrees: a task index, PTREE_SPINE or PTREE_EMPTY
+ */
+typedef struct ptree_spine_s
+{
+	const binary_tree_t *node;
+	size_t sub[2];
+} ptree_spine_t;
+
+/**
+ * struct ptree_job_s - parallel reduction over subtrees cut by size
+ * @roots: subtrees of at most PTREE_GRAIN nodes, one task each
+ * @stats: statistics of each task subtree
+ * @counts: number of values matching @func in each task subtree
+ * @size: number of tasks
+ * @spine: nodes above the tasks, in post-order
+ * @spine_size: number of spine nodes
+ * @largest: number of nodes in the largest task
+ * @func: predicate to count, or function to map, NULL for statistics
+ * @map: 1 if @func replaces the values, 0 if it is counted
+ * @total: number of values matching @func once combined
+ */
+typedef struct ptree_job_s
+{
+	const binary_tree_t **roots;
+	binary_tree_stats_t *stats;
+	size_t *counts;
+	size_t size;
+	ptree_spine_t *spine;
+	size_t spine_size;
+	size_t largest;
+	int (*func)(int);
+	int map;
+	size_t total;
+} ptree_job_t;
+
+/**
+ * struct lca_slot_s - slot of the node to position hash of an LCA index
+ * @node: indexed node, NULL for a free slot
+ * @index: pre-order position of the node
+ */
+typedef struct lca_slot_s
+{
+	const binary_tree_t *node;
+	unsigned int index;
+} lca_slot_t;
+
+/**
+ * struct lca_index_s - lowest common ancestor index of a tree
+ * @nodes: nodes in pre-order
+ * @depth: depth of each node, by pre-order position
+ * @table: sparse table, table[k][i] is the position of the shallowest node
+ * among positions i to i + 2^k - 1
+ * @levels: number of rows in @table
+ * @size: number of nodes
+ * @slots: open-addressing hash from node to pre-order position
+ * @mask: number of slots minus one
+ */
+typedef struct lca_index_s
+{
+	const binary_tree_t **nodes;
+	unsigned int *depth;
+	unsigned int **table;
+	size_t levels;
+	size_t size;
+	lca_slot_t *slots;
+	size_t mask;
+} lca_index_t;
+
+/* node allocation */
+tree_alloc_t *tree_alloc_set(tree_alloc_t *alloc);
+tree_alloc_t *tree_alloc_get(void);
+binary_tree_t *tree_node_alloc(void);
+void tree_node_free(binary_tree_t *node);
+void tree_node_free_to(tree_alloc_t *alloc, binary_tree_t *node);
+tree_pool_t *tree_pool_create(size_t per_slab);
+void tree_pool_destroy(tree_pool_t *pool);
+
+/* instrumentation */
+int bt_stats_get(bt_stats_t *stats);
+void bt_stats_reset(void);
+void bt_stats_merge(bt_stats_t *sum, const bt_stats_t *stats);
+void bt_stats_depth(size_t depth);
+
 /* functions */
 binary_tree_t *binary_tree_node(binary_tree_t *parent, int value);
+int node_height(const binary_tree_t *node);
+size_t node_size(const binary_tree_t *node);
+void node_update(binary_tree_t *node);
+void node_update_path(binary_tree_t *node);
 void binary_tree_print(const binary_tree_t *);
 binary_tree_t *binary_tree_insert_left(binary_tree_t *parent, int value);
 binary_tree_t *binary_tree_insert_right(binary_tree_t *parent, int value);
 void binary_tree_delete(binary_tree_t *tree);
+void binary_tree_delete_to(binary_tree_t *tree, tree_alloc_t *alloc);
+void binary_tree_delete_async(binary_tree_t *tree);
+void binary_tree_delete_wait(void);
 int binary_tree_is_leaf(const binary_tree_t *node);
 int binary_tree_is_root(const binary_tree_t *node);
 void binary_tree_preorder(const binary_tree_t *tree, void (*func)(int));
 void binary_tree_inorder(const binary_tree_t *tree, void (*func)(int));
 void binary_tree_postorder(const binary_tree_t *tree, void (*func)(int));
+const binary_tree_t *inorder_first(const binary_tree_t *root);
+const binary_tree_t *inorder_next(const binary_tree_t *node,
+		const binary_tree_t *root);
+const binary_tree_t *preorder_next(const binary_tree_t *node,
+		const binary_tree_t *root);
+const binary_tree_t *postorder_first(const binary_tree_t *root);
+const binary_tree_t *postorder_next(const binary_tree_t *node,
+		const binary_tree_t *root);
 size_t binary_tree_height(const binary_tree_t *tree);
 size_t binary_tree_depth(const binary_tree_t *tree);
 size_t binary_tree_size(const binary_tree_t *tree);
@@ -85,9 +720,13 @@ binary_tree_t *binary_tree_uncle(binary_tree_t *node);
 binary_tree_t *binary_trees_ancestor(
 		const binary_tree_t *first, const binary_tree_t *second);
 void binary_tree_levelorder(const binary_tree_t *tree, void (*func)(int));
-void enqueue(queue_t **queue, const binary_tree_t *data);
+int enqueue(queue_t **queue, const binary_tree_t *data);
 const binary_tree_t *dequeue(queue_t **queue);
 void free_queue(queue_t **queue);
+int levelorder_iter_init(levelorder_iter_t *iter, const binary_tree_t *tree);
+const binary_tree_t *levelorder_iter_next(levelorder_iter_t *iter,
+		int *new_level);
+void levelorder_iter_free(levelorder_iter_t *iter);
 int binary_tree_is_complete(const binary_tree_t *tree);
 binary_tree_t *binary_tree_rotate_left(binary_tree_t *tree);
 binary_tree_t *binary_tree_rotate_right(binary_tree_t *tree);
@@ -97,6 +736,8 @@ bst_t *bst_insert(bst_t **tree, int value);
 bst_t *array_to_bst(int *array, size_t size);
 void bst_free(bst_t *tree);
 bst_t *bst_search(const bst_t *tree, int value);
+void bst_search_batch(const bst_t *tree, const int *keys, size_t size,
+		bst_t **out);
 bst_t *bst_remove(bst_t *root, int value);
 bst_t *find_successor(bst_t *node);
 size_t max(size_t a, size_t b);
@@ -108,6 +749,147 @@ avl_t *avl_in_recur(avl_t **tree, avl_t *parent, avl_t **nw, int value);
 int b_lanc(const binary_tree_t *tree);
 size_t h_len(const binary_tree_t *tree);
 int comp_int(const void *a, const void *b);
+avl_t *avl_rebalance(avl_t *tree);
+avl_t *avl_remove(avl_t *root, int value);
+avl_t *avl_retrace(avl_t *tree);
+avl_t *avl_join(avl_t *left, avl_t *mid, avl_t *right);
+avl_t *avl_join2(avl_t *left, avl_t *right);
+avl_t *avl_remove_batch(avl_t *root, int *values, size_t size);
+avl_t *avl_split(avl_t *tree, int value, avl_t **left, avl_t **right);
+avl_t *avl_set_op(avl_t *a, avl_t *b, int op, size_t forks);
+avl_t *avl_union(avl_t *a, avl_t *b, size_t threads);
+avl_t *avl_intersection(avl_t *a, avl_t *b, size_t threads);
+avl_t *avl_difference(avl_t *a, avl_t *b, size_t threads);
+size_t pavl_live(void);
+pavl_node_t *pavl_node_new(int value);
+pavl_node_t *pavl_copy(const pavl_node_t *node);
+pavl_node_t *pavl_retain(pavl_node_t *node);
+void pavl_release(pavl_node_t *node);
+pavl_node_t *pavl_rebalance(pavl_node_t *node);
+pavl_node_t *pavl_insert(pavl_node_t *root, int value);
+pavl_node_t *pavl_remove(pavl_node_t *root, int value);
+const pavl_node_t *pavl_search(const pavl_node_t *root, int value);
+void pavl_cell_init(pavl_cell_t *cell);
+pavl_node_t *pavl_cell_snapshot(pavl_cell_t *cell);
+void pavl_cell_publish(pavl_cell_t *cell, pavl_node_t *root);
+void pavl_cell_destroy(pavl_cell_t *cell);
+cbst_node_t *cbst_node_new(int value);
+void cbst_enter(cbst_t *tree, cbst_thread_t *self);
+void cbst_leave(cbst_thread_t *self);
+void cbst_retire(cbst_t *tree, cbst_thread_t *self, cbst_node_t *node);
+cbst_t *cbst_create(void);
+void cbst_destroy(cbst_t *tree);
+cbst_thread_t *cbst_register(cbst_t *tree);
+void cbst_unregister(cbst_thread_t *self);
+int cbst_search(cbst_t *tree, cbst_thread_t *self, int value);
+int cbst_insert(cbst_t *tree, cbst_thread_t *self, int value);
+int cbst_remove(cbst_t *tree, cbst_thread_t *self, int value);
+int bst_flat_save(const bst_t *tree, const char *path);
+int bst_flat_map(const char *path, bst_flat_t *flat);
+void bst_flat_unmap(bst_flat_t *flat);
+const bst_flat_node_t *bst_flat_search(const bst_flat_t *flat, int value);
+avl_t *bst_flat_load(const bst_flat_t *flat);
+void ctree_init(ctree_t *tree, int balanced);
+void ctree_free(ctree_t *tree);
+uint32_t ctree_node_new(ctree_t *tree, int value);
+void ctree_node_del(ctree_t *tree, uint32_t i);
+uint32_t ctree_search(const ctree_t *tree, int value);
+int ctree_push(ctree_t *tree, size_t depth, uint32_t i);
+void ctree_relink(ctree_t *tree, size_t depth, uint32_t old, uint32_t i);
+void ctree_fix(ctree_t *tree, size_t depth);
+int ctree_insert(ctree_t *tree, int value);
+int ctree_remove(ctree_t *tree, int value);
+int ctree_inorder(ctree_t *tree, void (*func)(int));
+int bench_keys(int *keys, size_t n, int dist, uint64_t seed);
+const char *bench_dist_name(int dist);
+void bench_insert(tree_bench_t *bench);
+void bench_remove(tree_bench_t *bench);
+void bench_delete(tree_bench_t *bench);
+void bench_search(tree_bench_t *bench);
+void bench_inorder(tree_bench_t *bench);
+void bench_levelorder(tree_bench_t *bench);
+void bench_height(tree_bench_t *bench);
+const binary_tree_t *inorder_last(const binary_tree_t *root);
+const binary_tree_t *inorder_prev(const binary_tree_t *node,
+		const binary_tree_t *root);
+bst_t *bst_cursor_next(bst_cursor_t *cursor);
+bst_t *bst_cursor_prev(bst_cursor_t *cursor);
+void bst_cursor_init(bst_cursor_t *cursor, const bst_t *root);
+bst_t *bst_cursor_seek(bst_cursor_t *cursor, int value);
+bst_t *bst_cursor_lower_bound(bst_cursor_t *cursor, int value);
+bst_t *bst_cursor_upper_bound(bst_cursor_t *cursor, int value);
+size_t bst_range(const bst_t *root, int lo, int hi, void (*func)(int));
+int bst_freeze(const bst_t *tree, bst_frozen_t *frozen);
+void bst_frozen_free(bst_frozen_t *frozen);
+size_t bst_frozen_first(const bst_frozen_t *frozen);
+size_t bst_frozen_next(const bst_frozen_t *frozen, size_t k);
+avl_t *bst_thaw(const bst_frozen_t *frozen);
+size_t bst_frozen_lower_bound(const bst_frozen_t *frozen, int value);
+size_t bst_frozen_search(const bst_frozen_t *frozen, int value);
+void bst_frozen_inorder(const bst_frozen_t *frozen, void (*func)(int));
+int btree_rank(const btree_node_t *node, int value);
+btree_node_t *btree_node_new(int leaf);
+int btree_search(const btree_t *tree, int value);
+void btree_delete(btree_t *tree);
+int btree_insert(btree_t *tree, int value);
+int btree_remove(btree_t *tree, int value);
+void binary_tree_stats_join(binary_tree_stats_t *stats, int n,
+		const binary_tree_stats_t *left, const binary_tree_stats_t *right);
+int binary_tree_stats(const binary_tree_t *tree, binary_tree_stats_t *stats);
+avl_t *sorted_array_to_avl(int *array, size_t size);
+bst_t *sorted_array_to_bst(int *array, size_t size);
+int binary_tree_is_heap(const binary_tree_t *tree);
+size_t heap_size(const heap_t *root);
+heap_t *heap_nth(const heap_t *root, size_t pos);
+heap_t *heap_sift_up(heap_t *node);
+heap_t *heap_sift_down(heap_t *node);
+heap_t *heap_insert(heap_t **root, int value);
+heap_t *heap_update(heap_t *node, int value);
+heap_t *array_to_heap(int *array, size_t size);
+int heap_extract(heap_t **root);
+int *heap_to_sorted_array(heap_t *heap, size_t *size);
+size_t heap_array_sift_down(heap_array_t *heap, size_t i);
+int heap_array_push(heap_array_t *heap, int value);
+int heap_array_pop(heap_array_t *heap, int *value);
+size_t heap_array_update(heap_array_t *heap, size_t i, int value);
+int heap_array_heapify(heap_array_t *heap, const int *array, size_t size);
+int *heap_array_to_sorted(heap_array_t *heap, size_t *size);
+void heap_array_free(heap_array_t *heap);
+rb_t *rb_rotate(rb_t **root, rb_t *node, int left);
+void rb_update_size(rb_t *node);
+rb_t *rb_insert(rb_t **tree, int value);
+rb_t *rb_remove(rb_t *root, int value);
+rb_t *array_to_rb(int *array, size_t size);
+int binary_tree_is_rb(const binary_tree_t *tree);
+bst_t *bst_select(const bst_t *tree, size_t k);
+size_t bst_rank(const bst_t *tree, int value);
+size_t bst_range_count(const bst_t *tree, int lo, int hi);
+ws_pool_t *ws_pool_create(size_t size);
+void ws_pool_run(ws_pool_t *pool, void (*fn)(void *arg, size_t i),
+		void *arg, size_t count);
+void ws_pool_destroy(ws_pool_t *pool);
+int ptree_split(const binary_tree_t *tree, ptree_job_t *job);
+int ptree_run(const binary_tree_t *tree, ws_pool_t *pool, ptree_job_t *job,
+		binary_tree_stats_t *stats);
+int binary_tree_parallel_stats(const binary_tree_t *tree, ws_pool_t *pool,
+		binary_tree_stats_t *stats);
+int binary_tree_parallel_is_bst(const binary_tree_t *tree, ws_pool_t *pool);
+int binary_tree_parallel_is_avl(const binary_tree_t *tree, ws_pool_t *pool);
+size_t binary_tree_parallel_count_if(const binary_tree_t *tree,
+		ws_pool_t *pool, int (*pred)(int));
+int binary_tree_parallel_map(binary_tree_t *tree, ws_pool_t *pool,
+		int (*func)(int));
+size_t lca_index_hash(const lca_index_t *index, const binary_tree_t *node);
+lca_slot_t *lca_index_slot(const lca_index_t *index,
+		const binary_tree_t *node);
+size_t lca_index_find(const lca_index_t *index, const binary_tree_t *node);
+int lca_index_build(lca_index_t *index, const binary_tree_t *tree);
+void lca_index_free(lca_index_t *index);
+binary_tree_t *lca_index_query(const lca_index_t *index,
+		const binary_tree_t *first, const binary_tree_t *second);
+void lca_index_query_batch(const lca_index_t *index,
+		const binary_tree_t **first, const binary_tree_t **second,
+		binary_tree_t **out, size_t count);
 
 
 #endif /* BINARY_TREES_H */
@@ -0,0 +1,240 @@
+#ifndef TREE_MAP_H
+#define TREE_MAP_H
+
+#include <stdlib.h>
+#include "binary_trees.h"
+
+/*
+ * Ordered maps generated for a key type, a value type and a comparator.
+ *
+ * TREE_MAP_DECLARE(name, key_t, value_t, less) defines name_t, an AVL tree
+ * of key_t -> value_t, and the functions below, all static inline so that
+ * less is expanded at every comparison instead of being called through a
+ * pointer the way qsort calls comp_int:
+ *
+ *	void name_init(name_t *map);
+ *	value_t *name_get(const name_t *map, key_t key);
+ *	int name_put(name_t *map, key_t key, value_t value);
+ *	int name_remove(name_t *map, key_t key, value_t *value);
+ *	void name_foreach(const name_t *map,
+ *			  void (*func)(key_t key, value_t *value, void *arg),
+ *			  void *arg);
+ *	void name_clear(name_t *map);
+ *
+ * less(a, b) must be an expression, usually a macro, that is non-zero
+ * when a sorts before b; TREE_MAP_LESS does it for any type with <. Two
+ * keys are equal when neither is less than the other. name_get evaluates
+ * both tests before branching, so that for integer keys the compiler folds
+ * them into a single compare and picks the next child with a conditional
+ * move, as in bst_search. Keys and values are stored by copy in the nodes;
+ * the map never frees what they point to.
+ *
+ * Every node starts with a binary_tree_t, so only the key walks are
+ * generated: the map is kept balanced by node_update, avl_rebalance and
+ * the rotations of the int AVL tree, walked with inorder_first and
+ * inorder_next, and freed with binary_tree_delete_to. The n field of
+ * those nodes is unused.
+ */
+
+/* strict ordering of two numbers, pointers or enums */
+#define TREE_MAP_LESS(a, b) ((a) < (b))
+
+/**
+ * tree_map_retrace - refreshes and rebalances the nodes of a map from a
+ * node up to the root, after an entry was added or removed below it
+ * @node: pointer to the deepest node to refresh, may be NULL
+ * @root: pointer to the root node of the tree
+ * Return: pointer to the root node once balanced
+ */
+static inline binary_tree_t *tree_map_retrace(binary_tree_t *node,
+		binary_tree_t *root)
+{
+	binary_tree_t *up;
+
+	for (; node != NULL; node = up)
+	{
+		up = node->parent;
+		node_update(node);
+		node = avl_rebalance(node);
+		if (up == NULL)
+			root = node;
+	}
+	return (root);
+}
+
+/**
+ * tree_map_unlink - takes a node out of a map and rebalances the map
+ * @root: pointer to the root node of the tree
+ * @node: pointer to the node, which is not freed
+ *
+ * Description: a node with two children is replaced by its in-order
+ * successor, which is moved rather than copied, so that the values of
+ * the other entries keep their addresses.
+ * Return: pointer to the root node once balanced
+ */
+static inline binary_tree_t *tree_map_unlink(binary_tree_t *root,
+		binary_tree_t *node)
+{
+	binary_tree_t *next = node->right, *up = node->parent;
+
+	if (node->left == NULL || next == NULL)
+		next = node->left != NULL ? node->left : next;
+	else
+	{
+		next = (binary_tree_t *)inorder_first(next);
+		up = next;
+		if (next != node->right)
+		{
+			up = next->parent;
+			up->left = next->right;
+			if (next->right != NULL)
+				next->right->parent = up;
+			next->right = node->right;
+			next->right->parent = next;
+		}
+		next->left = node->left;
+		next->left->parent = next;
+	}
+	if (next != NULL)
+		next->parent = node->parent;
+	if (node->parent == NULL)
+		root = next;
+	else if (node->parent->left == node)
+		node->parent->left = next;
+	else
+		node->parent->right = next;
+	return (tree_map_retrace(up, root));
+}
+
+#define TREE_MAP_DECLARE(name, key_t, value_t, less)			\
+									\
+/**									\
+ * struct name##_node_s - node of the map				\
+ * @link: links and cached height, shared with the int trees		\
+ * @key: key of the entry						\
+ * @value: value of the entry						\
+ */									\
+typedef struct name##_node_s						\
+{									\
+	binary_tree_t link;						\
+	key_t key;							\
+	value_t value;							\
+} name##_node_t;							\
+									\
+/**									\
+ * struct name##_s - ordered map					\
+ * @root: Pointer to the root node, NULL when the map is empty		\
+ * @size: number of entries						\
+ */									\
+typedef struct name##_s							\
+{									\
+	binary_tree_t *root;						\
+	size_t size;							\
+} name##_t;								\
+									\
+static inline void name##_init(name##_t *map)				\
+{									\
+	map->root = NULL;						\
+	map->size = 0;							\
+}									\
+									\
+static inline name##_node_t *name##_find(const name##_t *map, key_t key) \
+{									\
+	name##_node_t *node = (name##_node_t *)map->root;		\
+	int before, after;						\
+									\
+	while (node != NULL)						\
+	{								\
+		before = less(key, node->key);				\
+		after = less(node->key, key);				\
+		if (!(before | after))					\
+			return (node);					\
+		node = (name##_node_t *)(before ? node->link.left :	\
+					 node->link.right);		\
+	}								\
+	return (NULL);							\
+}									\
+									\
+static inline value_t *name##_get(const name##_t *map, key_t key)	\
+{									\
+	name##_node_t *node = name##_find(map, key);			\
+									\
+	return (node != NULL ? &node->value : NULL);			\
+}									\
+									\
+/* 1 if key was added, 0 if its value was replaced, -1 on failure */	\
+static inline int name##_put(name##_t *map, key_t key, value_t value)	\
+{									\
+	name##_node_t *node = (name##_node_t *)map->root, *parent = NULL; \
+	int before = 0;							\
+									\
+	while (node != NULL)						\
+	{								\
+		before = less(key, node->key);				\
+		if (!before && !less(node->key, key))			\
+		{							\
+			node->value = value;				\
+			return (0);					\
+		}							\
+		parent = node;						\
+		node = (name##_node_t *)(before ? node->link.left :	\
+					 node->link.right);		\
+	}								\
+	node = malloc(sizeof(name##_node_t));				\
+	if (node == NULL)						\
+		return (-1);						\
+	node->key = key;						\
+	node->value = value;						\
+	node->link.n = 0;						\
+	node->link.parent = (binary_tree_t *)parent;			\
+	node->link.left = node->link.right = NULL;			\
+	node_update(&node->link);					\
+	if (parent == NULL)						\
+		map->root = &node->link;				\
+	else if (before)						\
+		parent->link.left = &node->link;			\
+	else								\
+		parent->link.right = &node->link;			\
+	map->root = tree_map_retrace((binary_tree_t *)parent, map->root); \
+	map->size++;							\
+	return (1);							\
+}									\
+									\
+/* 1 if key was removed, its value stored in *value if not NULL */	\
+static inline int name##_remove(name##_t *map, key_t key,		\
+		value_t *value)						\
+{									\
+	name##_node_t *node = name##_find(map, key);			\
+									\
+	if (node == NULL)						\
+		return (0);						\
+	if (value != NULL)						\
+		*value = node->value;					\
+	map->root = tree_map_unlink(map->root, &node->link);		\
+	map->size--;							\
+	free(node);							\
+	return (1);							\
+}									\
+									\
+/* calls func on every entry in key order */				\
+static inline void name##_foreach(const name##_t *map,			\
+		void (*func)(key_t, value_t *, void *), void *arg)	\
+{									\
+	const binary_tree_t *link;					\
+	name##_node_t *node;						\
+									\
+	for (link = inorder_first(map->root); link != NULL;		\
+	     link = inorder_next(link, map->root))			\
+	{								\
+		node = (name##_node_t *)link;				\
+		func(node->key, &node->value, arg);			\
+	}								\
+}									\
+									\
+static inline void name##_clear(name##_t *map)				\
+{									\
+	binary_tree_delete_to(map->root, NULL);				\
+	name##_init(map);						\
+}
+
+#endif /* TREE_MAP_H */